@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/15 11:48:08 by vberdugo          #+#    #+#             */
-/*   Updated: 2025/04/26 23:21:03 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,30 +19,127 @@
 # include <stdio.h>
 # include <string.h>
 # include <math.h>
+# include <pthread.h>
+# define GLFW_INCLUDE_NONE
+# include <GLFW/glfw3.h>
 # include "libft.h"
 # include "MLX42.h"
 
 /*------------------------------------------------------------------------------
 GAME CONSTANTS
 ------------------------------------------------------------------------------*/
-# define WIDTH 1600
-# define HEIGHT 900
 # define COLLISION_RADIUS 0.2
 # define DOOR_ANIM_DURATION 0.25
+# define DOOR_DEPTH 0.1
+# define DOOR_AUTO_CLOSE 4.0
+# define DOOR_REACH 1.5
+# define CELL_FREE -1
+# define CELL_SOLID -2
+# define ENEMY_SIGHT 10.0
+# define SIGHT_PER_TICK 4
+# define ENEMY_NEAR 6.0
+# define ENEMY_WAKE 12.0
+# define ENEMY_FAR_STEP 0.1
+# define LOD_PER_TICK 32
+# define ENEMY_ATLAS 5
+# define ENEMY_SIDES 8
+# define ANIM_LOOP -1
+# define ANIM_HOLD -2
+/*------------------------------------------------------------------------------
+RUNTIME SETTINGS DEFAULTS (overridable from the command line / config file)
+------------------------------------------------------------------------------*/
+# define DEF_WIDTH 1600
+# define DEF_HEIGHT 900
+# define DEF_FOV 86
+# define DEF_MINI_SCALE 10
+# define DEF_WEAPON_SCALE 180
+# define MIN_WIDTH 320
+# define MIN_HEIGHT 200
+# define MAX_WIDTH 7680
+# define MAX_HEIGHT 4320
+/*------------------------------------------------------------------------------
+ADAPTIVE RESOLUTION SETTINGS
+------------------------------------------------------------------------------*/
+# define TARGET_FRAME_MS 16.0
+# define VIEW_MIN_SCALE 50
+# define VIEW_SCALE_STEP 10
+# define VIEW_BILINEAR false
+/*------------------------------------------------------------------------------
+DISTANCE SHADING SETTINGS
+------------------------------------------------------------------------------*/
+# define SHADE_LEVELS 64
+# define SHADE_FALLOFF 0.25
+# define SHADE_MIN 0.25
+# define SHADE_EMISSIVE 0.2
+/*------------------------------------------------------------------------------
+LIGHT MAP SETTINGS
+------------------------------------------------------------------------------*/
+# define LIGHT_AMBIENT 185
+# define LIGHT_RADIUS 5
+# define LIGHT_LAMP 220
+# define LIGHT_PANEL 80
+# define LIGHT_STEP 8
+/*------------------------------------------------------------------------------
+FLOOR AND CEILING TEXTURE SETTINGS
+------------------------------------------------------------------------------*/
+# define FLAT_TEX_MAX_BITS 9
+/*------------------------------------------------------------------------------
+VARIABLE HEIGHT CELL SETTINGS
+------------------------------------------------------------------------------*/
+# define BLOCK_TILES "4567"
+# define SOLID_TILES "145689"
+# define COLUMN_SLABS 8
+# define LOW_WALL_HEIGHT 0.5
+# define STEP_HEIGHT 0.25
+# define WINDOW_SILL 0.35
+# define LINTEL_HEIGHT 0.7
+/*------------------------------------------------------------------------------
+THIN WALL SETTINGS
+------------------------------------------------------------------------------*/
+# define THIN_TILES "89"
+# define COLUMN_THINS 4
+# define MASK_ALPHA 128
+/*------------------------------------------------------------------------------
+FRAME PACING SETTINGS
+------------------------------------------------------------------------------*/
+# define DEF_FPS 0
+# define DEF_VSYNC true
+# define MAX_FPS 1000
+# define PACE_REPORT_S 1.0
+/*------------------------------------------------------------------------------
+CPU DISPATCH SETTINGS
+------------------------------------------------------------------------------*/
+# define DEF_SIMD -1
+# if defined(__x86_64__) || defined(__i386__)
+#  define SIMD_X86 1
+# else
+#  define SIMD_X86 0
+# endif
+/*------------------------------------------------------------------------------
+BENCHMARK SETTINGS (--bench=<frames>)
+------------------------------------------------------------------------------*/
+# define BENCH_DT 0.0166666666666666667
+# define BENCH_TURN 0.5
+/*------------------------------------------------------------------------------
+MEMORY ARENA SETTINGS
+------------------------------------------------------------------------------*/
+# define ARENA_ALIGN 16
+# define LEVEL_ARENA_BLOCK 16384
+# define FRAME_ARENA_BLOCK 4096
+/*------------------------------------------------------------------------------
+INTERLEAVED RENDERING SETTINGS
+------------------------------------------------------------------------------*/
+# define INTERLEAVE_DEPTH_TOL 0.05
 /*------------------------------------------------------------------------------
 MINIMAP SETTINGS
 ------------------------------------------------------------------------------*/
-# define MINI_SCALE 10
-# define MINI_VIEW_DIST 9
-# define MINI_X 110
-# define MINI_Y 110
-# define MINI_RADIUS 90
+# define MINI_MARGIN 20
+# define MINI_MIN_RADIUS 10
 /*------------------------------------------------------------------------------
 HUD & WEAPON SETTINGS
 ------------------------------------------------------------------------------*/
 # define COLS      4
 # define ROWS      4
-# define SCALE     1.8f
 # define Y_OFFSET  10
 
 /*------------------------------------------------------------------------------
@@ -66,11 +163,45 @@ typedef struct s_camera
 	double	view_z;		// Vertical view offset (jumping/crouching)
 }	t_camera;
 
+/*------------------------------------------------------------------------------
+RENDERING STRUCTURES
+------------------------------------------------------------------------------*/
+
+// Wall/door texture drawing parameters
+typedef struct s_draw
+{
+	int				lh;		// Line height
+	int				ds;		// Draw start Y
+	int				de;		// Draw end Y
+	int				tx;		// Texture X coordinate
+	int				light;	// Light map sample in front of the hit
+	mlx_texture_t	*tex;	// Pointer to texture
+}	t_draw;
+
+// Partial-height cell crossed by a column ray (BLOCK_TILES): a part standing
+// on the floor and/or a part hanging from the ceiling, in wall heights
+typedef struct s_slab
+{
+	double	near;		// Distance where the ray enters the cell
+	double	far;		// Distance where the ray leaves the cell
+	double	floor;		// Top of the floor part (0: none)
+	double	ceil;		// Bottom of the ceiling part (1: none)
+	t_draw	draw;		// Front face texture, column and light
+	int		open[2];	// View rows still open behind the slab
+}	t_slab;
+
+// See-through thin wall (THIN_TILES) crossed by a column ray, drawn over
+// what lies behind it
+typedef struct s_thin
+{
+	double	dist;	// Perpendicular distance of the wall plane
+	t_draw	draw;	// Texture column, light and rows drawn this frame
+}	t_thin;
+
 // Raycasting calculation results
 typedef struct s_ray
 {
 	t_vec2	raydir;			// Direction of cast ray
-	double	raydir_mod;		// Modified ray direction magnitude
 	int		map_x;			// Current map X coordinate
 	int		map_y;			// Current map Y coordinate
 	t_vec2	deltadist;		// Distance between grid lines
@@ -79,21 +210,46 @@ typedef struct s_ray
 	int		side;			// Wall side (0=X, 1=Y)
 	double	perpwalldist;	// Perpendicular wall distance
 	char	hit_tile;		// Type of tile hit ('1', '2', etc.)
+	bool	door;			// Ray crossed or hit a door cell
+	t_slab	*slab;			// Partial cells met, NULL to pass through them
+	int		slabs;			// Partial cells recorded in `slab`
+	double	clip[2];		// Open span left, as (y - horizon) / view height
+	t_thin	*thin;			// See-through walls met, NULL to stop on them
+	int		thins;			// See-through walls recorded in `thin`
 }	t_ray;
 
-/*------------------------------------------------------------------------------
-RENDERING STRUCTURES
-------------------------------------------------------------------------------*/
-
-// Wall/door texture drawing parameters
-typedef struct s_draw
+// Wall column kept between frames by the render cache
+typedef struct s_column
 {
-	int				lh;		// Line height
-	int				ds;		// Draw start Y
-	int				de;		// Draw end Y
-	int				tx;		// Texture X coordinate
-	mlx_texture_t	*tex;	// Pointer to texture
-}	t_draw;
+	double	dist;	// Perpendicular wall distance
+	t_draw	draw;	// Line height, texture and texture column
+	bool	door;	// Column depends on a door cell
+	int		slabs;	// Partial cells in front of the wall (cache.slabs)
+	int		thins;	// See-through walls in front of it (cache.thins)
+}	t_column;
+
+// What the render cache has to redo this frame
+typedef enum e_cache_mode
+{
+	CACHE_HIT,		// Nothing changed, reuse the world layer
+	CACHE_DOORS,	// Only doors moved, retrace their columns
+	CACHE_VIEW_Z,	// Only view_z changed, redraw cached columns
+	CACHE_MISS		// Camera moved, retrace everything
+}	t_cache_mode;
+
+// Frame-to-frame cache of the world layer (background + walls)
+typedef struct s_frame_cache
+{
+	t_camera	cam;			// Camera of the cached frame
+	bool		valid;			// Cache holds a complete frame
+	bool		doors_dirty;	// A door changed since the cached frame
+	bool		light_dirty;	// The light map changed since the cached frame
+	t_column	*cols;			// Cached wall columns (one per view column)
+	t_column	*reproj;		// Previous columns moved to the current view
+	t_slab		*slabs;			// COLUMN_SLABS partial cells per column
+	t_thin		*thins;			// COLUMN_THINS see-through walls per column
+	int			parity;			// Columns traced this frame (interleaved)
+}	t_frame_cache;
 
 // Door state tracking
 typedef struct s_door
@@ -104,8 +260,21 @@ typedef struct s_door
 	int		orientation;	// '2'=vertical, '3'=horizontal
 	double	open_offset;	// Animation progress (0-1)
 	double	move_progress;	// Current animation time
+	double	timer;			// Time left open before closing itself
+	int		scheduled;		// In the scheduler's active set
+	int		queued;			// State change waiting in the event queue
 }	t_door;
 
+// Door scheduler: only doors that move or wait to close are ticked, and
+// state changes are queued for the systems that depend on them
+typedef struct s_door_sched
+{
+	int		*active;		// Indices of the doors ticked each frame
+	int		active_count;
+	int		*events;		// Doors opened or closed since the last dispatch
+	int		event_count;
+}	t_door_sched;
+
 /*------------------------------------------------------------------------------
 ENEMY SYSTEM STRUCTURES
 ------------------------------------------------------------------------------*/
@@ -120,7 +289,8 @@ typedef struct s_enemy
 		ENEMY_ATTACK,
 		ENEMY_COOLDOWN,
 		ENEMY_HIT,
-		ENEMY_DEAD
+		ENEMY_DEAD,
+		ENEMY_STATES
 	} e_state;
 	// Movement directions
 	enum
@@ -148,19 +318,74 @@ typedef struct s_enemy
 	double	radius;
 	double	anim_timer;
 	int		hit_count;
-	double	attack_cooldown;
 	int		hit_flash;
 	double	knockback_time;
 	t_vec2	knockback_dir;
+	t_vec2	step;			// Move requested this frame (see move_enemies)
+	bool	sees_player;	// Cached line of sight (see update_sight)
+	// Update rate (see update_lod)
+	enum
+	{
+		LOD_DORMANT,
+		LOD_FAR,
+		LOD_NEAR
+	} lod;
+	double	lod_dt;			// Time not simulated yet at a reduced rate
 }	t_enemy;
 
+// Animation of one enemy state, compiled by `build_enemy_anim`
+typedef struct s_anim_clip
+{
+	bool	sided;	// Column picked by facing side, frames go down the rows
+	int		row;	// Atlas cell of the first frame
+	int		col;
+	int		count;	// Frames in the clip
+	double	time;	// Seconds per frame
+	int		next;	// State after the last frame, ANIM_LOOP or ANIM_HOLD
+	int		base;	// First rect of the clip in t_enemy_anim.rects
+}	t_anim_clip;
+
+// Atlas rectangle of one frame seen from one side
+typedef struct s_anim_rect
+{
+	int		x;
+	int		y;
+	bool	flip;
+}	t_anim_rect;
+
+typedef struct s_enemy_anim
+{
+	t_anim_clip	clips[ENEMY_STATES];
+	t_anim_rect	*rects;	// [base + frame * ENEMY_SIDES + e_dir]
+	int			w;		// Frame size in texels
+	int			h;
+}	t_enemy_anim;
+
 /*------------------------------------------------------------------------------
 WEAPON SYSTEM STRUCTURES
 ------------------------------------------------------------------------------*/
 
+// Run of opaque pixels copied as one block
+typedef struct s_span
+{
+	int	dst;		// Index of the first pixel in the screen image
+	int	src;		// Index of the first pixel in the frame pool
+	int	len;		// Number of pixels
+}	t_span;
+
+// Animation frame pre-scaled to the window and stored as opaque spans
+typedef struct s_sprite_frame
+{
+	t_span		*spans;		// Opaque runs, top to bottom
+	uint32_t	*px;		// Pixel pool in image byte order
+	int			n_spans;
+	int			n_px;
+}	t_sprite_frame;
+
 typedef struct s_weapon
 {
 	mlx_texture_t	*texture;			// Weapon spritesheet
+	t_sprite_frame	frames[COLS * ROWS];// Pre-scaled animation frames
 	int				current_frame;		// Current animation frame
 	bool			is_attacking;		// Attack state flag
 	double			frame_timer;		// Animation timing
@@ -196,36 +421,270 @@ typedef struct s_collision
 	double	dy;
 }	t_collision;
 
+// Collision cells of the level, built once at load time so a test reads
+// one cell instead of the map row and every door
+typedef struct s_solid_grid
+{
+	int	w;		// Cells per row (longest map row)
+	int	h;		// Rows
+	int	*cell;	// CELL_FREE, CELL_SOLID or the index of the cell's door
+}	t_solid_grid;
+
+// Circle moved by `move_circles`
+typedef struct s_mover
+{
+	t_vec2	pos;		// Center, moved in place
+	t_vec2	delta;		// Requested displacement
+	int		id;			// Caller's index of the mover
+	bool	blocked;	// A wall or door stopped part of the move
+}	t_mover;
+
 typedef struct s_ceiling
 {
-	t_vec2		wrd;
-	t_vec2		frac;
-	t_collision	col;
-	int			x;
-	int			y;
+	t_vec2			wrd;
+	t_vec2			frac;
+	t_collision		col;
+	int				x;
+	int				y;
+	int				shade;	// Shade row of the pixel
+	uint32_t		*row;	// Scanline in the scene buffer
+	const uint8_t	*glow;	// Shade row of the light panels
 }	t_ceiling;
 
+// Precomputed background lookup tables
+typedef struct s_bg_tables
+{
+	int		w;					// View width the tables were built for
+	int		h;					// View height the tables were built for
+	double	*sx;				// Horizontal sine distortions
+	double	*cy;				// Vertical cosine distortions
+	uint8_t	*shade;				// Shade rows of the current scanline
+	bool	light_panel[225];	// Ceiling light panel pattern
+}	t_bg_tables;
+
 typedef struct s_draw_data
 {
-	int		sprite_height;
-	int		sprite_width;
-	int		st_x;
-	int		end_x;
-	int		st_y;
-	int		end_y;
-	int		tex_width;
-	int		tex_height;
-	int		width;
-	int		hgt;
-	int		offset_x;
-	int		offset_y;
-	double	transform_y;
+	int				sprite_height;
+	int				sprite_width;
+	int				st_x;
+	int				end_x;
+	int				st_y;
+	int				end_y;
+	int				tex_width;
+	int				tex_height;
+	int				width;
+	int				hgt;
+	int				offset_x;
+	int				offset_y;
+	bool				flip;	// Mirror the frame (enemy sprites)
+	double			transform_y;
+	const uint8_t	*lut;	// Shade row of the sprite
+	int				clip[2];	// Rows of the column left open by walls
+	int				vx;		// Render view column of the stripe
+	int				thins;	// See-through walls in front of the sprite
 }	t_draw_data;
 
+// Internal render resolution, upscaled into the window image
+typedef struct s_view
+{
+	int		w;			// Render width
+	int		h;			// Render height
+	double	z;			// view_z scaled to the render height
+	int		scale;		// Render size in percent of the window
+	bool	bilinear;	// Bilinear instead of nearest upscale
+	double	frame_ms;	// Smoothed cost of fully rendered frames
+	int		cooldown;	// Frames left before the next rescale
+	int		*fx;		// Window X -> view X (8.8 fixed point)
+	int		*fy;		// Window Y -> view Y (8.8 fixed point)
+}	t_view;
+
+// Per-column camera rays, shared by walls, ceiling and sprites
+typedef struct s_ray_table
+{
+	int		w;			// View width cam_x was built for
+	double	*cam_x;		// Camera-space X per column: 2 * x / w - 1
+	t_vec2	*dir;		// World ray direction per column (this frame)
+	double	inv_det;	// 1 / det([plane dir]), world -> camera space
+}	t_ray_table;
+
+// How frames are paced, derived from the fps and vsync settings
+typedef enum e_pace_mode
+{
+	PACE_UNCAPPED,	// Run as fast as possible
+	PACE_VSYNC,		// Let the buffer swap wait for the display
+	PACE_TARGET		// Sleep to a fixed frame rate
+}	t_pace_mode;
+
+// Runtime settings, from the command line and an optional config file
+typedef struct s_config
+{
+	int			width;			// Window width
+	int			height;			// Window height
+	int			fov;			// Horizontal field of view (degrees)
+	int			mini_radius;	// Minimap radius in pixels (-1 = auto)
+	int			mini_scale;		// Minimap pixels per map cell
+	int			mini_x;			// Minimap center X
+	int			mini_y;			// Minimap center Y
+	int			mini_view_dist;	// Map cells shown around the player
+	double		weapon_scale;	// Weapon height relative to the window
+	bool		interleave;		// Trace half the columns per moving frame
+	int			fps;			// Frame rate cap (0 = none)
+	bool		vsync;			// Sync to the display when not capped
+	t_pace_mode	pace;			// Pacing mode derived from fps and vsync
+	int			bench;			// Scripted benchmark length (0 = play)
+	int			simd;			// Forced kernel variant (-1 = detect)
+}	t_config;
+
+// Instruction set levels of the CPU-dispatched kernels
+typedef enum e_simd_level
+{
+	SIMD_BASE,		// Baseline of the build (-march)
+	SIMD_SSE42,		// SSE4.2
+	SIMD_AVX2,		// AVX2
+	SIMD_AVX512,	// AVX-512 F + BW
+	SIMD_LEVELS
+}	t_simd_level;
+
+// One row of work for the upscale kernels, passed by value so the kernels
+// can keep every field in registers
+typedef struct s_row_job
+{
+	uint32_t		*dst;	// Output row
+	const uint32_t	*r0;	// Source row
+	const uint32_t	*r1;	// Second source row (blend_rows)
+	const int		*fx;	// Output X -> r0 X, 8.8 fixed point
+	int				w;		// Pixels to write
+	int				last;	// Last column of r0 (stretch_row)
+	uint32_t		f;		// Weight of r1 in [0, 256] (blend_rows)
+}	t_row_job;
+
+typedef void	(*t_row_kernel)(t_row_job j);
+
+// One scanline of a textured floor or ceiling for `flat_span`; texture
+// coordinates are in texels, 16.16 fixed point, and wrap modulo 2^32 (a
+// multiple of every texture side)
+typedef struct s_span_job
+{
+	uint32_t		*restrict dst;	// First pixel of the span
+	const uint32_t	*tex;	// Texels (see t_flat_tex)
+	const uint8_t	*shade;	// Shade row of each pixel (see shade_span)
+	const uint32_t	*mul;	// 8.8 factor of each shade row
+	int				w;		// Pixels to write
+	int				bits;	// log2 of the texture side
+	uint32_t		u;		// Texture X of the first pixel
+	uint32_t		v;		// Texture Y of the first pixel
+	uint32_t		du;		// Texture X step per pixel
+	uint32_t		dv;		// Texture Y step per pixel
+}	t_span_job;
+
+typedef void	(*t_span_kernel)(t_span_job j);
+
+// Kernel variants selected for this CPU by `init_kernels`
+typedef struct s_kernels
+{
+	t_simd_level	level;
+	t_row_kernel	nearest_row;	// dst[x] = r0[round(fx[x])]
+	t_row_kernel	blend_rows;		// dst[x] = lerp(r0[x], r1[x], f)
+	t_row_kernel	stretch_row;	// dst[x] = lerp(r0[i], r0[i + 1], fx[x])
+	t_span_kernel	flat_span;		// dst[x] = shade(tex[v, u]), u += du...
+}	t_kernels;
+
+// Distance shade table (see shade_bonus.c)
+typedef struct s_shade
+{
+	uint8_t		lut[SHADE_LEVELS][256];	// lut[level][channel]
+	uint32_t	floor[SHADE_LEVELS];	// Floor color shaded by each row
+	uint32_t	ceiling[SHADE_LEVELS];	// Ceiling color shaded by each row
+	uint32_t	mul[SHADE_LEVELS];		// Each row as an 8.8 factor
+}	t_shade;
+
+// Window layers, composited by MLX from the lowest depth up
+typedef enum e_layer_id
+{
+	LAYER_WORLD,	// Sky, floor, walls and enemies (app->image)
+	LAYER_MINIMAP,	// Minimap disc
+	LAYER_WEAPON,	// HUD weapon
+	LAYER_EFFECTS,	// Full-screen effects (hit feedback)
+	LAYER_COUNT
+}	t_layer_id;
+
+// Separate window images, each redrawn only when its inputs change
+typedef struct s_layers
+{
+	mlx_image_t	*img[LAYER_COUNT];	// Layer images, indexed by depth
+	bool		dirty[LAYER_COUNT];	// Layer must be redrawn this frame
+	t_camera	mini_cam;			// Camera the minimap was drawn for
+	uint64_t	mini_enemies;		// Signature of the enemies near the player
+	uint64_t	sprites;			// Signature of the sprites drawn
+	int			weapon_frame;		// Frame in the weapon layer (-1 = none)
+	int			effect_alpha;		// Opacity of the effects layer
+}	t_layers;
+
+// Render thread: draws the world of frame N from a snapshot while the MLX
+// thread simulates frame N + 1
+typedef struct s_render_thread
+{
+	pthread_t		thread;
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	bool			running;	// Thread and its context exist
+	bool			busy;		// A frame is being rendered
+	bool			pending;	// A rendered frame waits to be presented
+	bool			quit;		// Ask the thread to exit
+	double			frame_ms;	// Cost of a fully retraced frame, else -1
+	double			input_time;	// Input sampling time of the frame in flight
+	mlx_image_t		*back;		// World image the thread renders into
+	struct s_app	*ctx;		// Render-side copy of the app
+}	t_render_thread;
+
 /*------------------------------------------------------------------------------
 GAME STATE STRUCTURES
 ------------------------------------------------------------------------------*/
 
+// One block of an arena; its bytes follow the header
+typedef struct s_arena_block
+{
+	struct s_arena_block	*next;	// Previously filled block
+	unsigned char			*data;	// First usable byte (ARENA_ALIGN aligned)
+	size_t					size;	// Usable bytes
+	size_t					used;	// Bytes handed out
+}	t_arena_block;
+
+// Bump allocator: allocations are never freed one by one, the whole arena
+// is reset or released at once
+typedef struct s_arena
+{
+	t_arena_block	*head;			// Block currently being filled
+	size_t			block_size;		// Minimum size of a new block
+}	t_arena;
+
+// Light received by every map cell, baked from the light sources
+typedef struct s_light_map
+{
+	int		w;			// Cells per row (longest map row)
+	int		h;			// Rows
+	uint8_t	*source;	// Light emitted by each cell (lamps, ceiling panels)
+	uint8_t	*cell;		// Light received by each cell, 0 for walls
+	uint8_t	*corner;	// Light at cell corners ((w + 1) * (h + 1))
+}	t_light_map;
+
+// Floor or ceiling texture, resampled to a power-of-two square so texture
+// coordinates wrap with a mask
+typedef struct s_flat_tex
+{
+	uint32_t	*px;	// Raw pixels, row by row; NULL if untextured
+	int			bits;	// log2 of the side
+}	t_flat_tex;
+
+// Alpha mask of the thin wall texture: the opaque runs of each of its
+// columns, so transparent texels are skipped without being read
+typedef struct s_mask
+{
+	int		*col;		// First run of each column (width + 1 entries)
+	int		*run;		// Runs, as [start, end) texture rows
+	bool	opaque;		// No transparent texel: thin walls stop rays
+}	t_mask;
+
 // Main game configuration
 typedef struct s_game
 {
@@ -249,6 +708,10 @@ typedef struct s_game
 	int				map_started;
 	t_door			*doors;
 	int				door_count;
+	t_door_sched	door_sched;
+	// Collision grid and the movers of the enemies' batched moves
+	t_solid_grid	solid;
+	t_mover			*movers;
 	char			*texture_door;
 	char			*texture_door_w;
 	char			*texture_enemy;
@@ -256,39 +719,108 @@ typedef struct s_game
 	mlx_texture_t	*tex_door_w;
 	// Enemy system
 	mlx_texture_t	*tex_enemy;
+	t_enemy_anim	enemy_anim;
 	t_enemy			*enemies;
 	int				enemy_count;
+	int				sight_next;
+	int				lod_next;
 	// Weapon system
 	char			*texture_weapon;
 	mlx_texture_t	*tex_weapon;
+	// Floor and ceiling textures (FT, CT), optional
+	char			*texture_floor;
+	char			*texture_ceil;
+	t_flat_tex		floor_tex;
+	t_flat_tex		ceil_tex;
+	// Thin wall texture (GR), optional, and its alpha mask
+	char			*texture_thin;
+	mlx_texture_t	*tex_thin;
+	t_mask			thin_mask;
+	// Baked lighting
+	t_light_map		light;
+	// Level arena: map, doors, enemies, light map, texture paths, the
+	// floor and ceiling texels and the thin wall mask
+	t_arena			arena;
 }	t_game;
 
+// Frame pacing and latency statistics (MLX thread)
+typedef struct s_pacer
+{
+	double	next;		// Deadline of the next frame (PACE_TARGET)
+	double	input_time;	// When the last simulation step sampled input
+	double	latency;	// Smoothed input-to-present latency (ms)
+	double	report;		// Start of the current statistics period
+	int		frames;		// Frames presented in the current period
+	size_t	allocs;		// Allocation count at the start of the period
+}	t_pacer;
+
+// Benchmark run state (--bench)
+typedef struct s_bench
+{
+	int		frame;		// Frames simulated so far
+	double	start;		// Time of the first benchmark frame
+}	t_bench;
+
 // Main application container
 typedef struct s_app
 {
 	mlx_t			*mlx;				// MLX graphics context
-	mlx_image_t		*image;				// Main render target
+	mlx_image_t		*image;				// World layer (window resolution)
+	mlx_image_t		*scene;				// Off-screen world layer
+	t_config		cfg;				// Runtime settings
+	t_view			view;				// Render resolution
 	t_camera		cam;				// Player camera
 	t_game			game;				// Game state
-	double			z_buffer[WIDTH];	// Depth buffer
+	double			*z_buffer;			// Depth buffer (per view column)
+	t_bg_tables		bg;					// Background lookup tables
+	t_ray_table		rays;				// Camera rays of the frame
 	t_hit_feedback	player_hit_feedback;// Damage effect
 	t_weapon		weapon;				// Weapon state
+	t_frame_cache	cache;				// World layer cache
+	t_layers		layers;				// Window layers
+	t_render_thread	worker;				// Render thread
+	t_pacer			pacer;				// Frame pacing
+	t_arena			frame;				// Scratch memory (render thread)
+	t_bench			bench;				// Benchmark run
+	t_kernels		kernels;			// CPU-dispatched kernels
+	t_shade			shade;				// Distance shade table
 }	t_app;
 
+// Subscriber to door state changes (see `dispatch_door_events`)
+typedef void	(*t_door_handler)(t_app *app, const t_door *d);
+
 /*------------------------------------------------------------------------------
 FUNCTION DECLARATIONS
 ------------------------------------------------------------------------------*/
 
 // Core game loop
-void		render_scene(void *param);
+double		render_scene(t_app *a);
 void		move_camera(void *param);
+void		rotate_camera(t_app *app, double alpha);
+void		bench_camera(t_app *app, double dt);
+void		run_frame(void *param);
+void		init_pacer(t_app *app);
+void		pace_frame(t_app *app);
+void		record_present(t_app *app, double input_time);
+int			start_render_thread(t_app *app);
+void		stop_render_thread(t_app *app);
 
 //Raycast system
 void		do_dda(t_app *app, t_ray *ray);
+bool		mid_plane(const t_ray *ray, int axis, double *t);
 void		compute_texture_params(t_app *app, t_ray *ray, t_draw *draw);
 void		calculate_grid_coordinates(t_vec2 world, t_collision *col);
 char		safe_get_tile(t_game *game, int x, int y);
-void		draw_pixels(t_app *app, int x, t_draw *draw);
+void		draw_pixels(t_app *app, int x, t_draw *draw, double dist);
+void		trace_wall_column(t_app *app, int x);
+void		draw_wall_column(t_app *app, int x);
+bool		add_slab(t_app *app, t_ray *ray);
+void		draw_slabs(t_app *app, int x, int *open);
+void		open_rows(const t_app *app, int x, double depth, int *rows);
+bool		sprite_rows(const t_app *app, int x, double depth, t_draw_data *d);
+bool		add_thin(t_app *app, t_ray *ray);
+void		draw_thins(t_app *app, int x);
+bool		thin_hides(const t_app *app, const t_draw_data *d, int y);
 
 // Map parsing
 void		process_lines(char **lines, int c, t_game *game, t_camera *camera);
@@ -296,35 +828,111 @@ int			read_lines(const char *filename, char ***lines, int *line_count);
 void		validate_map(t_game *game, t_camera *camera);
 int			load_map(char *filename, char ***lines, int *line_count);
 char		*skip_spaces(char *s);
+int			parse_extra_texture(char *trimmed, t_game *game);
+
+// Runtime configuration
+int			load_config(t_config *cfg, int argc, char **argv);
+int			init_render_config(t_app *app, const t_config *cfg);
 
 // Initialization
 int			init_app_struct(t_app *app, char **lines, int line_count);
 int			load_game_textures(t_app *app);
-void		init_ray(t_app *app, int x, t_ray *ray);
+int			load_flat_textures(t_app *app);
+int			load_thin_texture(t_app *app);
+void		init_ray(t_app *app, t_vec2 dir, t_ray *ray);
+int			init_ray_table(t_ray_table *t, int max_w);
+void		update_ray_table(t_app *app);
+t_vec2		to_camera_space(const t_app *app, t_vec2 rel);
+void		reserve_entities(t_game *g);
 void		init_door(t_game *g, int i, int j, char c);
 void		init_enemy(t_game *g, int i, int j);
 void		init_collision(t_collision *c, double new_x, double new_y);
 void		weapon_initialize(t_weapon *w, bool *inited);
-void		init_background_tables(double *sx, double *cy,
-				double *cameraX_table, bool light_panel_pattern[225]);
+void		init_background_tables(t_bg_tables *t, int w, int h);
 
 // Rendering systems
-void		ft_draw_background(t_app *app);
+void		ft_draw_background(t_app *app, int start, int end);
+void		draw_flat_span(t_app *app, int y, const int *span);
+uint32_t	flat_texel(const t_flat_tex *t, double x, double y);
+t_cache_mode	render_world(t_app *app);
+void		present_scene(t_app *app);
+void		render_interleaved(t_app *app, const t_camera *prev);
+int			set_view_scale(t_app *app, int scale);
+void		update_view_scale(t_app *app, double frame_ms);
 void		render_minimap(t_app *app);
 void		render_enemy(t_app *app, t_enemy *e);
+int			visible_sprites(const t_app *a, t_enemy **out, uint64_t *sig);
 void		render_weapon(t_app *app);
+int			build_weapon_cache(t_app *app);
+void		free_weapon_cache(t_weapon *w);
+int			build_weapon_frame(t_app *app, int frame, t_sprite_frame *f);
 void		render_hit_feedback(t_app *app);
+int			hit_feedback_alpha(const t_app *app);
 int32_t		ft_pixel(int32_t r, int32_t g, int32_t b, int32_t a);
 uint32_t	convert_pixel(uint32_t px);
 void		draw_minimap_background(t_app *app);
 void		draw_map_features(t_app *app);
 void		update_weapon_animation(t_app *app, double delta_time);
 void		update_door_animation(t_app *app, double dt);
-uint32_t	fog(const int *color, double r, double fog_dens, double min_factor);
+void		set_door_state(t_game *g, int i, int open);
+void		dispatch_door_events(t_app *app);
+void		door_minimap_event(t_app *app, const t_door *d);
+
+// Distance shading
+void		init_shade_table(t_shade *s, const t_game *g);
+int			shade_level(double dist);
+int			shade_row(int level, int light);
+uint32_t	shade_pixel(const uint8_t *lut, uint32_t px);
+uint32_t	shade_color(const uint8_t *lut, const int *color);
+
+// Light map
+int			bake_light_map(t_app *app);
+void		door_light_event(t_app *app, const t_door *d);
+void		relight_area(t_game *g, int x, int y, int r);
+int			light_at(const t_light_map *m, double x, double y);
+void		shade_span(const t_app *a, double r, const int *span, uint8_t *out);
+
+// CPU-dispatched kernels
+int			init_kernels(t_app *app);
+const char	*simd_name(t_simd_level level);
+int			detect_simd(void);
+void		select_kernels(t_kernels *k);
+void		nearest_row_base(t_row_job j);
+void		blend_rows_base(t_row_job j);
+void		stretch_row_base(t_row_job j);
+void		flat_span_base(t_span_job j);
+# if SIMD_X86
+void		nearest_row_sse42(t_row_job j);
+void		nearest_row_avx2(t_row_job j);
+void		nearest_row_avx512(t_row_job j);
+void		blend_rows_sse42(t_row_job j);
+void		blend_rows_avx2(t_row_job j);
+void		blend_rows_avx512(t_row_job j);
+void		stretch_row_sse42(t_row_job j);
+void		stretch_row_avx2(t_row_job j);
+void		stretch_row_avx512(t_row_job j);
+void		flat_span_sse42(t_span_job j);
+void		flat_span_avx2(t_span_job j);
+void		flat_span_avx512(t_span_job j);
+# endif
+
+// Compositing
+uint32_t	pack_pixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+uint32_t	lerp_pixel(uint32_t a, uint32_t b, uint32_t f);
+void		fill_pixels(uint32_t *px, size_t n, uint32_t color);
+int			init_layers(t_app *app);
+void		update_layers(t_app *app, t_cache_mode mode, bool doors,
+				uint64_t sprites);
 
 // Collision detection
 int			collides(t_game *game, double new_x, double new_y);
+int			build_collision_grid(t_game *g);
+int			cell_at(const t_game *g, int x, int y);
+bool		move_circle(t_game *g, t_vec2 *pos, t_vec2 delta);
+void		move_circles(t_game *g, t_mover *m, int n);
 int			check_door_collision(t_app *app, t_ray *ray);
+int			find_door(const t_game *g, int x, int y);
+bool		door_occupied(const t_app *app, const t_door *d);
 
 // Player systems
 void		get_down(t_app *app, double *speed);
@@ -335,18 +943,31 @@ void		toggle_doors(t_app *app);
 void		update_enemies(t_app *app, double delta_time);
 void		update_enemy(t_app *app, t_enemy *e, t_camera *cam, double dt);
 void		update_enemy_dir(t_app *app, t_enemy *enemy, double delta_time);
-void		handle_enemy_collision(t_app *app, t_enemy *e, t_camera *cam);
-void		move_towards_cam(t_app *app, t_enemy *e, t_camera *cam, double dt);
+void		move_enemies(t_app *app, bool push);
+void		move_towards_cam(t_enemy *e, t_camera *cam, double dt);
+bool		line_of_sight(t_app *app, t_vec2 to);
+void		update_sight(t_app *app);
+void		update_lod(t_app *app);
+bool		lod_tick(t_enemy *e, double dt, double *step);
+int			build_enemy_anim(t_app *app);
+void		set_enemy_state(t_enemy *e, int state);
+void		animate_enemy(const t_enemy_anim *a, t_enemy *e, double dt);
 void		apply_hit_to_enemy(t_app *app);
-void		process_knockback(t_app *a, t_enemy *e, double dt);
+void		process_knockback(t_enemy *e, double dt);
 void		check_enemy_attack_hit(t_app *app, t_enemy *e, t_camera *cam);
 void		update_hit_feedback(t_app *app, double dt);
 void		apply_hit_flash(uint32_t *color, t_enemy *e);
 
+// Memory arenas
+void		*arena_alloc(t_arena *a, size_t n);
+char		*arena_strtrim(t_arena *a, const char *s, const char *set);
+void		arena_reset(t_arena *a);
+void		arena_free(t_arena *a);
+
 // Utility functions
 void		safe_free(t_app *app);
 void		free_map_lines(char **lines, int line_count);
-void		cleanup(t_app *app);
+int			cleanup(t_app *app);
 void		close_window(void *param);
 
 #endif
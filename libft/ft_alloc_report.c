@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc_report.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:40:37 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include <stdio.h>
+
+// Closes a frame: counts the allocations made since the previous call.
+// The first call only sets the mark, start-up allocations are not a frame.
+void	ft_alloc_frame(void)
+{
+	t_alloc_track	*t;
+	size_t			n;
+
+	t = ft_tracker();
+	pthread_mutex_lock(&t->lock);
+	n = t->st.allocs - t->st.frame_mark;
+	if (t->st.frame_mark)
+	{
+		t->st.frames++;
+		if (n)
+			t->st.alloc_frames++;
+		if (n > t->st.frame_max)
+			t->st.frame_max = n;
+	}
+	t->st.frame_mark = t->st.allocs;
+	pthread_mutex_unlock(&t->lock);
+}
+
+// Copies the current counters; `enabled` is 0 unless tracking is linked in.
+void	ft_alloc_stats(t_alloc_stats *out)
+{
+	t_alloc_track	*t;
+
+	t = ft_tracker();
+	pthread_mutex_lock(&t->lock);
+	*out = t->st;
+	pthread_mutex_unlock(&t->lock);
+}
+
+// Next site in (bytes, index) descending order after (`bytes`, `idx`).
+static int	next_site(t_alloc_track *t, size_t bytes, int idx)
+{
+	t_alloc_site	*s;
+	int				best;
+	int				i;
+
+	best = -1;
+	i = -1;
+	while (++i < FT_TRACK_SITES)
+	{
+		s = &t->sites[i];
+		if (!s->addr || s->bytes > bytes || (s->bytes == bytes && i >= idx))
+			continue ;
+		if (best < 0 || s->bytes >= t->sites[best].bytes)
+			best = i;
+	}
+	return (best);
+}
+
+// Prints the totals, the frame counters, the blocks still live (leaks when
+// called at exit) and the FT_TRACK_REPORT call sites that allocated most.
+// Does nothing unless tracking is linked in. Call it once the other
+// threads are done allocating. Returns 1 if any frame allocated, so the
+// exit status can fail a run on them, and 0 otherwise.
+int	ft_alloc_report(int fd)
+{
+	t_alloc_track	*t;
+	t_alloc_site	*s;
+	int				i;
+	int				n;
+
+	t = ft_tracker();
+	if (!t->st.enabled)
+		return (0);
+	dprintf(fd, "alloc: %zu allocs, %zu frees, %zu bytes, peak %zu bytes\n",
+		t->st.allocs, t->st.frees, t->st.bytes, t->st.peak_bytes);
+	dprintf(fd, "alloc: %zu of %zu frames allocated, max %zu per frame\n",
+		t->st.alloc_frames, t->st.frames, t->st.frame_max);
+	dprintf(fd, "alloc: %zu blocks (%zu bytes) live, %zu untracked\n",
+		t->st.live, t->st.live_bytes, t->st.untracked);
+	i = next_site(t, (size_t)-1, FT_TRACK_SITES);
+	n = 0;
+	while (i >= 0 && n++ < FT_TRACK_REPORT)
+	{
+		s = &t->sites[i];
+		dprintf(fd, "alloc: %p %8zu calls %10zu bytes %6zu live\n",
+			s->addr, s->count, s->bytes, s->live);
+		i = next_site(t, s->bytes, i);
+	}
+	return (t->st.alloc_frames != 0);
+}
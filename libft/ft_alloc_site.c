@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc_site.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:33 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+// Call site the tracked allocations of this thread are charged to while a
+// libft or arena entry point runs, NULL otherwise. Per thread, so the render
+// thread and the MLX thread never charge each other's allocations.
+void	**ft_alloc_caller(void)
+{
+	static __thread void	*site;
+
+	return (&site);
+}
+
+// Called by an allocating entry point (ft_calloc, ft_malloc, arena_alloc...)
+// with its own return address: the blocks it allocates are charged to its
+// caller instead of the entry point. Nested entry points keep the outermost
+// caller. Returns 1 if this call set the site, for ft_alloc_leave.
+int	ft_alloc_enter(void *site)
+{
+	void	**caller;
+
+	caller = ft_alloc_caller();
+	if (*caller)
+		return (0);
+	*caller = site;
+	return (1);
+}
+
+// Ends the entry point that ft_alloc_enter returned `entered` for.
+void	ft_alloc_leave(int entered)
+{
+	if (entered)
+		*ft_alloc_caller() = NULL;
+}
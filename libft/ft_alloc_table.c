@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc_table.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:40:04 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:42:18 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+static size_t	slot_hash(void *ptr)
+{
+	return ((((size_t)ptr >> 4) * 2654435761u) & (FT_TRACK_SLOTS - 1));
+}
+
+// Finds the slot of a live pointer (open addressing, linear probing).
+// With `insert`, a missing pointer gets the empty slot that ends its probe.
+// Returns -1 if the pointer is unknown (or the table is full).
+int	ft_track_slot(t_alloc_track *t, void *ptr, int insert)
+{
+	size_t	i;
+	size_t	n;
+
+	i = slot_hash(ptr);
+	n = 0;
+	while (n++ < FT_TRACK_SLOTS)
+	{
+		if (t->slots[i].ptr == ptr)
+			return ((int)i);
+		if (!t->slots[i].ptr)
+		{
+			if (insert)
+				return ((int)i);
+			return (-1);
+		}
+		i = (i + 1) & (FT_TRACK_SLOTS - 1);
+	}
+	return (-1);
+}
+
+// Empties a slot and shifts the rest of its probe run back, so lookups never
+// need tombstones. An entry moves into the hole unless its home slot lies
+// cyclically in (hole, entry].
+void	ft_track_remove(t_alloc_track *t, int slot)
+{
+	size_t	hole;
+	size_t	j;
+	size_t	home;
+
+	hole = (size_t)slot;
+	j = hole;
+	while (1)
+	{
+		j = (j + 1) & (FT_TRACK_SLOTS - 1);
+		if (!t->slots[j].ptr)
+			break ;
+		home = slot_hash(t->slots[j].ptr);
+		if (((j - home) & (FT_TRACK_SLOTS - 1))
+			< ((j - hole) & (FT_TRACK_SLOTS - 1)))
+			continue ;
+		t->slots[hole] = t->slots[j];
+		hole = j;
+	}
+	t->slots[hole].ptr = NULL;
+}
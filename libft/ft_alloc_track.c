@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc_track.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:40:37 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:42:18 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+// Tracker state. It never allocates, so the malloc wrappers can use it.
+t_alloc_track	*ft_tracker(void)
+{
+	static t_alloc_track	t = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
+	return (&t);
+}
+
+// Index of the call site `addr` in the site table, added on first use.
+static int	site_index(t_alloc_track *t, void *addr)
+{
+	size_t	i;
+	size_t	n;
+
+	i = ((size_t)addr >> 2) & (FT_TRACK_SITES - 1);
+	n = 0;
+	while (n++ < FT_TRACK_SITES)
+	{
+		if (!t->sites[i].addr)
+			t->sites[i].addr = addr;
+		if (t->sites[i].addr == addr)
+			return ((int)i);
+		i = (i + 1) & (FT_TRACK_SITES - 1);
+	}
+	return (-1);
+}
+
+// Adds (sign 1) or removes (sign -1) a block from the live heap counters.
+static void	account(t_alloc_track *t, t_alloc_slot *s, int sign)
+{
+	t_alloc_site	*site;
+
+	t->st.live += sign;
+	t->st.live_bytes += sign * s->size;
+	if (t->st.live_bytes > t->st.peak_bytes)
+		t->st.peak_bytes = t->st.live_bytes;
+	if (s->site < 0)
+		return ;
+	site = &t->sites[s->site];
+	site->live += sign;
+	site->live_bytes += sign * s->size;
+}
+
+// Records a new block of `size` bytes allocated from `site`.
+void	ft_track_alloc(void *ptr, size_t size, void *site)
+{
+	t_alloc_track	*t;
+	int				i;
+
+	if (!ptr)
+		return ;
+	t = ft_tracker();
+	pthread_mutex_lock(&t->lock);
+	t->st.enabled = 1;
+	t->st.allocs++;
+	t->st.bytes += size;
+	i = ft_track_slot(t, ptr, 1);
+	if (i < 0)
+		t->st.untracked++;
+	else
+	{
+		t->slots[i] = (t_alloc_slot){ptr, size, site_index(t, site)};
+		if (t->slots[i].site >= 0)
+			t->sites[t->slots[i].site].count++;
+		if (t->slots[i].site >= 0)
+			t->sites[t->slots[i].site].bytes += size;
+		account(t, &t->slots[i], 1);
+	}
+	pthread_mutex_unlock(&t->lock);
+}
+
+// Records that a block is released. Unknown pointers are only counted.
+void	ft_track_free(void *ptr)
+{
+	t_alloc_track	*t;
+	int				i;
+
+	if (!ptr)
+		return ;
+	t = ft_tracker();
+	pthread_mutex_lock(&t->lock);
+	t->st.frees++;
+	i = ft_track_slot(t, ptr, 0);
+	if (i >= 0)
+	{
+		account(t, &t->slots[i], -1);
+		ft_track_remove(t, i);
+	}
+	pthread_mutex_unlock(&t->lock);
+}
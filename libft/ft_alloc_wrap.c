@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc_wrap.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:40:38 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+// Allocation tracking hooks, used when linking with
+// -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free (GNU ld).
+// Every call to these functions from the linked objects, libft included,
+// lands here and is recorded with its call site.
+
+// Call site of a block: the caller of the allocating entry point in progress
+// (see ft_alloc_enter), so blocks from ft_calloc or arena_alloc show the game
+// code that asked for them; otherwise `own`, the caller of malloc itself.
+static void	*call_site(void *own)
+{
+	void	*site;
+
+	site = *ft_alloc_caller();
+	if (site)
+		return (site);
+	return (own);
+}
+
+void	*__wrap_malloc(size_t size)
+{
+	void	*p;
+
+	p = __real_malloc(size);
+	ft_track_alloc(p, size, call_site(__builtin_return_address(0)));
+	return (p);
+}
+
+void	*__wrap_calloc(size_t nmemb, size_t size)
+{
+	void	*p;
+
+	p = __real_calloc(nmemb, size);
+	ft_track_alloc(p, nmemb * size, call_site(__builtin_return_address(0)));
+	return (p);
+}
+
+void	*__wrap_realloc(void *ptr, size_t size)
+{
+	void	*p;
+
+	p = __real_realloc(ptr, size);
+	if (p || !size)
+		ft_track_free(ptr);
+	ft_track_alloc(p, size, call_site(__builtin_return_address(0)));
+	return (p);
+}
+
+void	__wrap_free(void *ptr)
+{
+	ft_track_free(ptr);
+	__real_free(ptr);
+}
@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/19 17:10:11 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/07/08 12:23:52 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,9 +17,12 @@ void	*ft_calloc(size_t nmemb, size_t size)
 {
 	size_t	total_size;
 	void	*ptr;
+	int		site;
 
 	total_size = nmemb * size;
+	site = ft_alloc_enter(__builtin_return_address(0));
 	ptr = (void *)malloc(total_size);
+	ft_alloc_leave(site);
 	if (!ptr)
 		return (NULL);
 	ft_memset(ptr, 0, total_size);
@@ -6,10 +6,11 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/29 12:51:55 by victor            #+#    #+#             */
-/*   Updated: 2024/07/08 12:25:03 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "libft.h"
 #include <stdlib.h>
 
 static int	dig_len(int n)
@@ -27,6 +28,18 @@ static int	dig_len(int n)
 	return (length);
 }
 
+// Allocates the `dig` digits and terminator, charged to `caller`.
+static char	*alloc_digits(int dig, void *caller)
+{
+	char	*res;
+	int		site;
+
+	site = ft_alloc_enter(caller);
+	res = (char *)malloc(sizeof(char) * (dig + 1));
+	ft_alloc_leave(site);
+	return (res);
+}
+
 char	*ft_itoa(int n)
 {
 	char	*res;
@@ -35,7 +48,7 @@ char	*ft_itoa(int n)
 
 	nbr = n;
 	dig = dig_len(n);
-	res = (char *)malloc(sizeof(char) * (dig + 1));
+	res = alloc_digits(dig, __builtin_return_address(0));
 	if (!res)
 		return (NULL);
 	res[dig] = '\0';
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/30 13:55:33 by victor            #+#    #+#             */
-/*   Updated: 2024/07/08 12:32:31 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,8 +16,11 @@
 t_list	*ft_lstnew(void *content)
 {
 	t_list	*new_node;
+	int		site;
 
+	site = ft_alloc_enter(__builtin_return_address(0));
 	new_node = (t_list *)malloc(sizeof(t_list));
+	ft_alloc_leave(site);
 	if (!new_node)
 		return (NULL);
 	new_node->content = content;
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 16:05:25 by victor            #+#    #+#             */
-/*   Updated: 2025/03/28 12:42:15 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,8 +25,11 @@ size_t	ft_block_size(void *ptr)
 void	*ft_malloc(size_t size)
 {
 	t_block	*block;
+	int		site;
 
+	site = ft_alloc_enter(__builtin_return_address(0));
 	block = malloc(sizeof(t_block) + size);
+	ft_alloc_leave(site);
 	if (!block)
 		return (NULL);
 	block->size = size;
@@ -44,16 +47,17 @@ void	*ft_realloc(void *ptr, size_t new_size)
 	t_block	*new_block;
 	size_t	old_size;
 	size_t	copy_size;
+	int		site;
 
 	if (new_size == 0)
 	{
 		ft_free(ptr);
 		return (NULL);
 	}
-	if (ptr == NULL)
-		return (ft_malloc(new_size));
 	old_size = ft_block_size(ptr);
+	site = ft_alloc_enter(__builtin_return_address(0));
 	new_block = malloc(sizeof(t_block) + new_size);
+	ft_alloc_leave(site);
 	if (!new_block)
 		return (NULL);
 	new_block->size = new_size;
@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/27 11:12:29 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/07/08 12:36:07 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -62,24 +62,25 @@ char	**ft_split(char const *s, char c)
 	int		i;
 	int		j;
 	int		start;
+	int		site;
 
 	i = 0;
 	j = -1;
 	if (s == NULL)
 		return (NULL);
+	site = ft_alloc_enter(__builtin_return_address(0));
 	splt = (char **)ft_calloc((count_c(s, c) + 1), sizeof(char *));
-	if (splt == NULL)
-		return (NULL);
-	while (++j < count_c(s, c))
+	while (splt && ++j < count_c(s, c))
 	{
 		start = find_s(s, c, &i);
 		splt[j] = (char *)ft_calloc((i - start + 1), sizeof(char));
 		if (splt[j] == NULL)
 		{
 			free_splt(splt, j);
-			return (NULL);
+			splt = NULL;
 		}
-		ft_strlcpy(splt[j], &s[start], i - start + 1);
+		else
+			ft_strlcpy(splt[j], &s[start], i - start + 1);
 	}
-	return (splt);
+	return (ft_alloc_leave(site), splt);
 }
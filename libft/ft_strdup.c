@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/19 17:12:02 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/07/08 10:19:45 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,9 +17,12 @@ char	*ft_strdup(const char *s)
 {
 	size_t	len;
 	char	*dup;
+	int		site;
 
 	len = ft_strlen(s) + 1;
+	site = ft_alloc_enter(__builtin_return_address(0));
 	dup = (char *)malloc(len);
+	ft_alloc_leave(site);
 	if (dup == NULL)
 		return (NULL);
 	ft_strlcpy(dup, s, len);
@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/26 13:14:46 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/07/08 14:36:51 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,11 +17,14 @@ char	*ft_strjoin(char const *s1, char const *s2)
 {
 	char	*join;
 	int		i;
+	int		site;
 
 	if (s1 == NULL || s2 == NULL)
 		return (NULL);
 	i = 0;
+	site = ft_alloc_enter(__builtin_return_address(0));
 	join = (char *)malloc((ft_strlen(s1) + ft_strlen(s2) + 1) * sizeof(char));
+	ft_alloc_leave(site);
 	if (join == NULL)
 		return (NULL);
 	while (s1[i])
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/29 20:52:56 by victor            #+#    #+#             */
-/*   Updated: 2024/07/08 12:43:27 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,11 +18,14 @@ char	*ft_strmapi(char const *s, char (*f)(unsigned int, char))
 	size_t			len;
 	unsigned int	i;
 	char			*new_str;
+	int				site;
 
 	if (!s || !f)
 		return (NULL);
 	len = ft_strlen(s);
+	site = ft_alloc_enter(__builtin_return_address(0));
 	new_str = (char *)malloc(sizeof(char) * (len + 1));
+	ft_alloc_leave(site);
 	if (!new_str)
 		return (NULL);
 	i = 0;
@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/26 15:13:54 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/07/08 12:45:30 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,6 +19,7 @@ char	*ft_strtrim(char const *s1, char const *set)
 	char	*start;
 	char	*end;
 	size_t	len;
+	int		site;
 
 	if (!s1 || !set)
 		return (NULL);
@@ -29,7 +30,9 @@ char	*ft_strtrim(char const *s1, char const *set)
 	while (end >= start && ft_strchr(set, *end))
 		end--;
 	len = end - start + 1;
+	site = ft_alloc_enter(__builtin_return_address(0));
 	trim = (char *)malloc(len + 1);
+	ft_alloc_leave(site);
 	if (!trim)
 		return (NULL);
 	ft_strlcpy(trim, start, len + 1);
@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/26 12:34:36 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/07/08 12:45:53 by vberdugo         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,14 +17,17 @@ char	*ft_substr(char const *s, unsigned int start, size_t len)
 {
 	char	*sub;
 	size_t	i;
+	int		site;
 
 	if (s == NULL)
 		return (NULL);
 	if (start >= ft_strlen(s))
-		return (ft_strdup(""));
-	if (start + len > ft_strlen(s))
+		len = 0;
+	else if (start + len > ft_strlen(s))
 		len = ft_strlen(s) - start;
+	site = ft_alloc_enter(__builtin_return_address(0));
 	sub = (char *)malloc((len + 1) * sizeof(char));
+	ft_alloc_leave(site);
 	if (sub == NULL)
 		return (NULL);
 	i = 0;
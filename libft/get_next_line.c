@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/07/12 10:08:46 by vberdugo          #+#    #+#             */
-/*   Updated: 2024/10/16 21:25:59 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -91,7 +91,7 @@ static char	*read_new_line(int fd, char **buffer)
 	return (free(read_buffer), *buffer);
 }
 
-char	*get_next_line(int fd)
+static char	*next_line(int fd)
 {
 	static char	*buffer;
 	char		*line;
@@ -114,3 +114,16 @@ char	*get_next_line(int fd)
 	buffer = rem(buffer);
 	return (line);
 }
+
+// Entry point: the blocks allocated while reading are charged to the caller
+// by the allocation tracker.
+char	*get_next_line(int fd)
+{
+	char	*line;
+	int		site;
+
+	site = ft_alloc_enter(__builtin_return_address(0));
+	line = next_line(fd);
+	ft_alloc_leave(site);
+	return (line);
+}
@@ -6,7 +6,7 @@
 /*   By: vberdugo <vberdugo@student.42barcelon      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/15 12:20:41 by vberdugo          #+#    #+#             */
-/*   Updated: 2025/03/28 12:39:43 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,6 +16,7 @@
 # include <stddef.h>
 # include <stdarg.h>
 # include <stdlib.h>
+# include <pthread.h>
 
 # ifndef BUFFER_SIZE
 #  define BUFFER_SIZE 42
@@ -26,6 +27,10 @@
 #  define BUFFER_SIZE 1
 # endif
 
+# define FT_TRACK_SLOTS 65536
+# define FT_TRACK_SITES 1024
+# define FT_TRACK_REPORT 16
+
 typedef struct s_list
 {
 	void			*content;
@@ -37,6 +42,46 @@ typedef struct s_block
 	size_t	size;
 }	t_block;
 
+typedef struct s_alloc_stats
+{
+	int		enabled;
+	size_t	allocs;
+	size_t	frees;
+	size_t	bytes;
+	size_t	live;
+	size_t	live_bytes;
+	size_t	peak_bytes;
+	size_t	untracked;
+	size_t	frames;
+	size_t	alloc_frames;
+	size_t	frame_max;
+	size_t	frame_mark;
+}	t_alloc_stats;
+
+typedef struct s_alloc_site
+{
+	void	*addr;
+	size_t	count;
+	size_t	bytes;
+	size_t	live;
+	size_t	live_bytes;
+}	t_alloc_site;
+
+typedef struct s_alloc_slot
+{
+	void	*ptr;
+	size_t	size;
+	int		site;
+}	t_alloc_slot;
+
+typedef struct s_alloc_track
+{
+	pthread_mutex_t	lock;
+	t_alloc_stats	st;
+	t_alloc_slot	slots[FT_TRACK_SLOTS];
+	t_alloc_site	sites[FT_TRACK_SITES];
+}	t_alloc_track;
+
 int		ft_atoi(const char *nptr);
 void	ft_bzero(void *s, size_t n);
 void	*ft_calloc(size_t nmemb, size_t size);
@@ -98,5 +143,25 @@ char	*ft_strsep(char **stringp, const char *delim, int *in_q, char *q_char);
 void	*ft_malloc(size_t size);
 void	ft_free(void *ptr);
 void	*ft_realloc(void *ptr, size_t new_size);
+//allocation tracking
+t_alloc_track	*ft_tracker(void);
+void	ft_track_alloc(void *ptr, size_t size, void *site);
+void	ft_track_free(void *ptr);
+int		ft_track_slot(t_alloc_track *t, void *ptr, int insert);
+void	ft_track_remove(t_alloc_track *t, int slot);
+void	ft_alloc_frame(void);
+void	ft_alloc_stats(t_alloc_stats *out);
+int		ft_alloc_report(int fd);
+void	**ft_alloc_caller(void);
+int		ft_alloc_enter(void *site);
+void	ft_alloc_leave(int entered);
+void	*__real_malloc(size_t size);
+void	*__real_calloc(size_t nmemb, size_t size);
+void	*__real_realloc(void *ptr, size_t size);
+void	__real_free(void *ptr);
+void	*__wrap_malloc(size_t size);
+void	*__wrap_calloc(size_t nmemb, size_t size);
+void	*__wrap_realloc(void *ptr, size_t size);
+void	__wrap_free(void *ptr);
 
 #endif
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:35:14 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Pushes a new block able to hold at least `n` bytes (and never less than  */
+/*   the arena's block size) in front of the arena.                           */
+/*                                                                            */
+/*   - Header and data share one malloc; the data starts at the first         */
+/*     ARENA_ALIGN boundary after the header.                                 */
+/*   - Returns -1 on allocation failure, 0 otherwise.                         */
+/*                                                                            */
+/* ************************************************************************** */
+static int	new_block(t_arena *a, size_t n)
+{
+	t_arena_block	*b;
+	size_t			head;
+
+	head = (sizeof(t_arena_block) + ARENA_ALIGN - 1)
+		& ~(size_t)(ARENA_ALIGN - 1);
+	if (n < a->block_size)
+		n = a->block_size;
+	b = malloc(head + n);
+	if (!b)
+		return (-1);
+	b->next = a->head;
+	b->data = (unsigned char *)b + head;
+	b->size = n;
+	b->used = 0;
+	a->head = b;
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns `n` zeroed bytes aligned on ARENA_ALIGN, or NULL if out of       */
+/*   memory.                                                                  */
+/*                                                                            */
+/*   - Bumps the offset of the current block; a new block is only allocated   */
+/*     when the current one is full. Blocks that are left behind keep their   */
+/*     allocations until the arena is reset or freed.                         */
+/*   - A new block is charged to the caller by the allocation tracker         */
+/*     (`ft_alloc_enter`), not to the arena.                                  */
+/*                                                                            */
+/* ************************************************************************** */
+void	*arena_alloc(t_arena *a, size_t n)
+{
+	void	*p;
+	int		site;
+
+	n = (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	site = ft_alloc_enter(__builtin_return_address(0));
+	if ((!a->head || a->head->size - a->head->used < n)
+		&& new_block(a, n) == -1)
+		return (ft_alloc_leave(site), NULL);
+	ft_alloc_leave(site);
+	p = a->head->data + a->head->used;
+	a->head->used += n;
+	ft_bzero(p, n);
+	return (p);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Copies `s` into the arena without the leading and trailing characters    */
+/*   found in `set`, like `ft_strtrim`. An empty set copies `s` as is.        */
+/*                                                                            */
+/* ************************************************************************** */
+char	*arena_strtrim(t_arena *a, const char *s, const char *set)
+{
+	size_t	start;
+	size_t	end;
+	char	*dst;
+	int		site;
+
+	start = 0;
+	while (s[start] && ft_strchr(set, s[start]))
+		start++;
+	end = ft_strlen(s);
+	while (end > start && ft_strchr(set, s[end - 1]))
+		end--;
+	site = ft_alloc_enter(__builtin_return_address(0));
+	dst = arena_alloc(a, end - start + 1);
+	ft_alloc_leave(site);
+	if (!dst)
+		return (NULL);
+	ft_memcpy(dst, s + start, end - start);
+	return (dst);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Makes all the memory of the arena available again.                       */
+/*                                                                            */
+/*   - With a single block this only rewinds its offset.                      */
+/*   - If the arena had to grow, its blocks are released and the block size   */
+/*     raised to their total, so the next use gets one block large enough     */
+/*     and later resets stop allocating.                                      */
+/*                                                                            */
+/* ************************************************************************** */
+void	arena_reset(t_arena *a)
+{
+	t_arena_block	*b;
+	size_t			total;
+
+	if (!a->head)
+		return ;
+	if (!a->head->next)
+	{
+		a->head->used = 0;
+		return ;
+	}
+	total = 0;
+	b = a->head;
+	while (b)
+	{
+		total += b->size;
+		b = b->next;
+	}
+	arena_free(a);
+	a->block_size = total;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Releases every block of the arena; it can be used again afterwards.      */
+/*                                                                            */
+/* ************************************************************************** */
+void	arena_free(t_arena *a)
+{
+	t_arena_block	*next;
+
+	while (a->head)
+	{
+		next = a->head->next;
+		free(a->head);
+		a->head = next;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/22 02:02:47 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 20:26:07 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 15:43:57 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,29 +17,26 @@
 /*   Detect rays near grid cell boundaries.                                   */
 /*   - edge_mask set if frac.x or frac.y is within 0.005 of 0 or 1.           */
 /*   - Uses a bitmask (|) to combine the four edge‐tests                      */
-/*   - r = H/(2*(H/2 - view_z - y)): maps screen y to ray distance scale.     */
 /*   - Darken base ceiling color by 20% for edges.                            */
-/*   - Apply fog(dark_c, r, 0.4, 0.2) for depth fade.                         */
+/*   - Shade it like the surrounding ceiling (row `d->shade`).                */
 /*   - Returns true if an edge pixel was drawn, false otherwise.              */
 /*                                                                            */
 /* ************************************************************************** */
-static inline bool	handle_edge_case(t_app *app, int x, int y, t_vec2 frac)
+static inline bool	handle_edge_case(t_app *app, t_ceiling *d)
 {
 	int		*c;
 	int		edge_mask;
-	double	r;
 	int		dark_c[3];
 
-	edge_mask = (frac.x < 0.005f) | (frac.x > 0.995f) | (frac.y < 0.005f)
-		| (frac.y > 0.995f);
-	r = HEIGHT / (2.0 * (HEIGHT / 2 - app->cam.view_z - y));
+	edge_mask = (d->frac.x < 0.005f) | (d->frac.x > 0.995f)
+		| (d->frac.y < 0.005f) | (d->frac.y > 0.995f);
 	if (!edge_mask)
 		return (false);
 	c = app->game.c_color;
 	dark_c[0] = (int)(c[0] * 0.8);
 	dark_c[1] = (int)(c[1] * 0.8);
 	dark_c[2] = (int)(c[2] * 0.8);
-	mlx_put_pixel(app->image, x, y, fog(dark_c, r, 0.4, 0.2));
+	d->row[d->x] = shade_color(app->shade.lut[d->shade], dark_c);
 	return (true);
 }
 
@@ -47,27 +44,25 @@ static inline bool	handle_edge_case(t_app *app, int x, int y, t_vec2 frac)
 /*                                                                            */
 /*   Draw special ceiling panels with highlight zones.                        */
 /*   - Skip pixels not in the panel pattern lookup.                           */
-/*   - r = H/(2*(H/2 - view_z - y)): recompute depth scale.                   */
 /*   - If |dx-0.5|,|dy-0.5| < 0.3338, draw bright center (240,240,245).       */
 /*   - Else if max_dist < 0.4338, interpolate toward (235,235,240):           */
 /*       i = 1 - (max_dist - 0.3338)*10                                       */
-/*   - Apply fog(wht, r, 0.08, 0.2). Return true if drawn.                    */
+/*   - Panels are lights: they use the `glow` row, shaded at SHADE_EMISSIVE   */
+/*     times their distance. Return true if drawn.                            */
 /*                                                                            */
 /* ************************************************************************** */
 static inline bool	handle_light_panel(t_app *a, const bool *pattern,
 		t_ceiling *d)
 {
-	double	r;
 	double	max_dist;
 	double	i;
 	int		wht[3];
 
 	if (!pattern[d->col.i * 15 + d->col.j])
 		return (false);
-	r = HEIGHT / (2.0 * fmax(HEIGHT / 2 - a->cam.view_z - d->y, 0.01));
 	if (fabs(d->col.dx - 0.5) < 0.3338 && fabs(d->col.dy - 0.5) < 0.3338)
-		return (mlx_put_pixel(a->image, d->x, d->y,
-				fog((int [3]){240, 240, 245}, r, 0.08, 0.2)), true);
+		return (d->row[d->x] = shade_color(d->glow,
+				(int [3]){240, 240, 245}), true);
 	max_dist = fmax(fabs(d->col.dx - 0.5), fabs(d->col.dy - 0.5));
 	if (max_dist < 0.4338)
 	{
@@ -77,7 +72,7 @@ static inline bool	handle_light_panel(t_app *a, const bool *pattern,
 			wht[0] = a->game.c_color[0] + (int)((235 - a->game.c_color[0]) * i);
 			wht[1] = a->game.c_color[1] + (int)((235 - a->game.c_color[1]) * i);
 			wht[2] = a->game.c_color[2] + (int)((240 - a->game.c_color[2]) * i);
-			mlx_put_pixel(a->image, d->x, d->y, fog(wht, r, 0.08, 0.2));
+			d->row[d->x] = shade_color(d->glow, wht);
 			return (true);
 		}
 	}
@@ -87,99 +82,107 @@ static inline bool	handle_light_panel(t_app *a, const bool *pattern,
 /* ************************************************************************** */
 /*                                                                            */
 /*   Render ceiling per scanline using raycasting math.                       */
-/*   - r = H/(2*(H/2 - view_z - y)): vertical ray factor.                     */
-/*   - c = cam_x_table[x]: horizontal offset = 2x/WIDTH - 1.                  */
-/*   - world = pos + r*(dir + plane*c): compute hit point.                    */
+/*   - Only columns in [span[0], span[1]) are drawn.                          */
+/*   - r = H/(2*(H/2 - view.z - y)): vertical ray factor, H being the render  */
+/*     view height (see t_view).                                              */
+/*   - The shade rows of the scanline (distance and light map, see            */
+/*     shade_span) and the light panel row are computed once per row.         */
+/*   - world = pos + r*rays.dir[x]: compute hit point, with the same camera   */
+/*     rays as the walls (see t_ray_table).                                   */
 /*   - frac = fract(world): fractional offsets for effects.                   */
-/*   - Try edge highlight, then panel; else draw flat color with fog.         */
+/*   - Try edge highlight, then panel; else draw the ceiling color shaded by  */
+/*     the row of the pixel (precomputed in t_shade).                         */
 /*                                                                            */
 /* ************************************************************************** */
-static void	draw_ceiling(t_app *app, int y, const double *cam_x_table,
-		const bool light_panel[225])
+static void	draw_ceiling(t_app *app, int y, const int *span,
+		const t_bg_tables *t)
 {
-	int			x;
 	double		r;
-	double		c;
 	t_ceiling	d;
 
-	r = HEIGHT / (2.0 * (HEIGHT / 2 - app->cam.view_z - y));
-	x = -1;
-	while (++x < WIDTH)
+	r = app->view.h / (2.0 * (app->view.h / 2 - app->view.z - y));
+	d.y = y;
+	d.row = (uint32_t *)app->scene->pixels + y * app->scene->width;
+	d.glow = app->shade.lut[shade_level(r * SHADE_EMISSIVE)];
+	shade_span(app, r, span, app->bg.shade);
+	d.x = span[0] - 1;
+	while (++d.x < span[1])
 	{
-		d.y = y;
-		d.x = x;
-		c = cam_x_table[x];
-		d.wrd.x = app->cam.pos.x + r * (app->cam.dir.x + app->cam.plane.x * c);
-		d.wrd.y = app->cam.pos.y + r * (app->cam.dir.y + app->cam.plane.y * c);
+		d.shade = app->bg.shade[d.x];
+		d.wrd.x = app->cam.pos.x + r * app->rays.dir[d.x].x;
+		d.wrd.y = app->cam.pos.y + r * app->rays.dir[d.x].y;
 		d.frac.x = d.wrd.x - (int)d.wrd.x;
 		d.frac.y = d.wrd.y - (int)d.wrd.y;
 		calculate_grid_coordinates(d.wrd, &d.col);
-		if (handle_edge_case(app, x, y, d.frac))
+		if (handle_edge_case(app, &d))
 			continue ;
-		if (handle_light_panel(app, light_panel, &d))
+		if (handle_light_panel(app, t->light_panel, &d))
 			continue ;
-		mlx_put_pixel(app->image, x, y, fog(app->game.c_color,
-				r, 0.4, 0.2));
+		d.row[d.x] = app->shade.ceiling[d.shade];
 	}
 }
 
 /* ************************************************************************** */
 /*                                                                            */
 /*   Render floor per scanline using inverse projection.                      */
-/*   - horizon = H/2 - view_z; r = H/(2*(y - horizon)).                       */
-/*   - For each x, draw floor_color with fog(floor_color, r, 0.3, 0.2).       */
+/*   - horizon = H/2 - view.z; r = H/(2*(y - horizon)).                       */
+/*   - The shade row of each pixel combines the distance r and the light map  */
+/*     (see shade_span); the floor color shaded by every row is precomputed,  */
+/*     so each pixel is a single table load.                                  */
 /*                                                                            */
 /* ************************************************************************** */
-static void	draw_floor(t_app *app, int y)
+static void	draw_floor(t_app *app, int y, const int *span)
 {
-	int		x;
-	int		h;
-	double	r;
+	uint32_t	*row;
+	double		r;
+	int			x;
 
-	h = HEIGHT / 2 - app->cam.view_z;
-	r = HEIGHT / (2.0 * (y - h));
-	x = -1;
-	while (++x < WIDTH)
-	{
-		mlx_put_pixel(app->image, x, y, fog(app->game.floor_color,
-				r, 0.3, 0.2));
-	}
+	r = app->view.h / (2.0 * (y - (app->view.h / 2 - app->view.z)));
+	shade_span(app, r, span, app->bg.shade);
+	row = (uint32_t *)app->scene->pixels + y * app->scene->width;
+	x = span[0] - 1;
+	while (++x < span[1])
+		row[x] = app->shade.floor[app->bg.shade[x]];
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   - Orchestrates ceiling and floor drawing across all scanlines.           */
-/*   - Uses static lookup tables for performance:                             */
+/*   - Orchestrates ceiling and floor drawing across all scanlines for the    */
+/*     columns in [start, end). The render cache uses single-column spans to  */
+/*     repaint only the columns it retraces.                                  */
+/*   - Uses the app's lookup tables for performance (see t_bg_tables):        */
 /*       sx[]     → per-x plane offsets                                       */
 /*       cy[]     → per-y depth scales                                        */
-/*       cam[]    → same as sx (for camera rays)                              */
 /*       light_panel[] → pattern mask for panels                              */
 /*   - view_offs_y[0] = horizon line in screen coords                         */
 /*   - view_offs_y[1,2] = parallax offsets based on camera position           */
-/*   - Loops y from 0 to H–1: draws ceiling if y < horizon, else floor.       */
+/*   - Loops y over the render view height: ceiling if y < horizon, else      */
+/*     floor. A textured ceiling (CT) or floor (FT) is drawn by               */
+/*     draw_flat_span instead.                                                */
 /*                                                                            */
 /* ************************************************************************** */
-void	ft_draw_background(t_app *app)
+void	ft_draw_background(t_app *app, int start, int end)
 {
-	static double	sx[WIDTH];
-	static double	cy[HEIGHT];
-	static double	cam[WIDTH];
-	static bool		light_panel[225];
-	int				view_offs_y[4];
+	int	view_offs_y[4];
+	int	span[2];
 
-	init_background_tables(sx, cy, cam, light_panel);
-	view_offs_y[0] = HEIGHT / 2 - app->cam.view_z;
+	init_background_tables(&app->bg, app->view.w, app->view.h);
+	span[0] = start;
+	span[1] = end;
+	view_offs_y[0] = app->view.h / 2 - app->view.z;
 	view_offs_y[1] = ((int)(app->cam.pos.x * 0.3)
-			% WIDTH + WIDTH) % WIDTH;
+			% app->view.w + app->view.w) % app->view.w;
 	view_offs_y[2] = ((int)(app->cam.pos.y * 0.3)
-			% HEIGHT + HEIGHT) % HEIGHT;
+			% app->view.h + app->view.h) % app->view.h;
 	view_offs_y[3] = 0;
-	while (view_offs_y[3] < HEIGHT)
+	while (view_offs_y[3] < app->view.h)
 	{
-		if (view_offs_y[3] < view_offs_y[0])
-			draw_ceiling(app, view_offs_y[3], cam, light_panel);
+		if (view_offs_y[3] < view_offs_y[0] && !app->game.ceil_tex.px)
+			draw_ceiling(app, view_offs_y[3], span, &app->bg);
+		else if (view_offs_y[3] >= view_offs_y[0] && !app->game.floor_tex.px)
+			draw_floor(app, view_offs_y[3], span);
 		else
-			draw_floor(app, view_offs_y[3]);
+			draw_flat_span(app, view_offs_y[3], span);
 		view_offs_y[3]++;
 	}
 }
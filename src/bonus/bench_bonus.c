@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:43:49 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:59:21 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Prints the result of a benchmark run: frames, wall time, average frame   */
+/*   time, frame rate and kernel variant.                                     */
+/*                                                                            */
+/* ************************************************************************** */
+static void	bench_report(t_app *app, double now)
+{
+	double	elapsed;
+
+	elapsed = now - app->bench.start;
+	if (elapsed <= 0.0)
+		elapsed = 1e-9;
+	printf("bench: %d frames in %.2f s, %.2f ms/frame (%.1f fps), %s\n",
+		app->cfg.bench, elapsed, elapsed * 1000.0 / app->cfg.bench,
+		app->cfg.bench / elapsed, simd_name(app->kernels.level));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Drives the camera during a benchmark run (--bench=<frames>) instead of   */
+/*   the keyboard and mouse; used to compare builds and to train PGO builds.  */
+/*                                                                            */
+/*   - The camera walks forward and turns at BENCH_TURN rad/s. A wall ahead   */
+/*     turns it by 90 degrees, so it keeps sweeping through the map.          */
+/*   - After `cfg.bench` frames the result is printed and the window closed.  */
+/*   - Stamps the input sampling time like `update_camera_movement`.          */
+/*                                                                            */
+/* ************************************************************************** */
+void	bench_camera(t_app *app, double dt)
+{
+	t_bench	*b;
+	t_vec2	next;
+
+	b = &app->bench;
+	app->pacer.input_time = mlx_get_time();
+	if (b->frame == 0)
+		b->start = app->pacer.input_time;
+	if (b->frame++ == app->cfg.bench)
+	{
+		bench_report(app, app->pacer.input_time);
+		mlx_close_window(app->mlx);
+		return ;
+	}
+	next.x = app->cam.pos.x + app->cam.dir.x * app->cam.move_speed * dt;
+	next.y = app->cam.pos.y + app->cam.dir.y * app->cam.move_speed * dt;
+	if (collides(&app->game, next.x, next.y))
+		rotate_camera(app, M_PI / 2);
+	else
+		app->cam.pos = next;
+	rotate_camera(app, BENCH_TURN * dt);
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:27:02 by victor            #+#    #+#             */
-/*   Updated: 2025/04/24 19:08:40 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:24:10 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,7 +30,9 @@ static void	check_escape(t_app *app)
 /*                                                                            */
 /*   - Moves forward (W) or backward (S) along the camera's direction vector. */
 /*   - Moves left (A) or right (D) perpendicular to the direction vector.     */
-/*   - Prevents movement if a collision is detected.                          */
+/*   - Slides along walls and doors instead of stopping (`move_circle`).      */
+/*   - Stamps the input sampling time, the start of the input-to-present      */
+/*     latency measured by `record_present`.                                  */
 /*                                                                            */
 /*   The movement logic works as follows:                                     */
 /*   - The direction vector (dir.x, dir.y) represents where the camera is     */
@@ -45,30 +47,24 @@ static void	check_escape(t_app *app)
 
 static void	update_camera_movement(t_app *app, double delta_time)
 {
-	double		new_x;
-	double		new_y;
+	t_vec2		delta;
 	double		speed;
 
-	new_x = app->cam.pos.x;
-	new_y = app->cam.pos.y;
+	app->pacer.input_time = mlx_get_time();
 	speed = app->cam.move_speed * delta_time;
 	if (mlx_is_key_down(app->mlx, MLX_KEY_LEFT_SHIFT))
 		speed *= 2;
 	get_down(app, &speed);
 	jump(app);
-	new_x += (mlx_is_key_down(app->mlx, MLX_KEY_W)
+	delta.x = (mlx_is_key_down(app->mlx, MLX_KEY_W)
 			- mlx_is_key_down(app->mlx, MLX_KEY_S)) * app->cam.dir.x * speed;
-	new_y += (mlx_is_key_down(app->mlx, MLX_KEY_W)
+	delta.y = (mlx_is_key_down(app->mlx, MLX_KEY_W)
 			- mlx_is_key_down(app->mlx, MLX_KEY_S)) * app->cam.dir.y * speed;
-	new_x += (mlx_is_key_down(app->mlx, MLX_KEY_A)
+	delta.x += (mlx_is_key_down(app->mlx, MLX_KEY_A)
 			- mlx_is_key_down(app->mlx, MLX_KEY_D)) * app->cam.dir.y * speed;
-	new_y += (mlx_is_key_down(app->mlx, MLX_KEY_D)
+	delta.y += (mlx_is_key_down(app->mlx, MLX_KEY_D)
 			- mlx_is_key_down(app->mlx, MLX_KEY_A)) * app->cam.dir.x * speed;
-	if (!collides(&app->game, new_x, new_y))
-	{
-		app->cam.pos.x = new_x;
-		app->cam.pos.y = new_y;
-	}
+	move_circle(&app->game, &app->cam.pos, delta);
 }
 
 /* ************************************************************************** */
@@ -88,7 +84,7 @@ static void	update_camera_movement(t_app *app, double delta_time)
 /*   - Applying the rotation matrix rotates both vectors around the origin.   */
 /*                                                                            */
 /* ************************************************************************** */
-static void	rotate_camera(t_app *app, double alpha)
+void	rotate_camera(t_app *app, double alpha)
 {
 	double	old_dir_x;
 	double	old_plane_x;
@@ -122,18 +118,20 @@ static void	update_camera_rotation(t_app *app, double delta_time)
 	double	offset_z;
 
 	mlx_get_mouse_pos(app->mlx, &posx, &posz);
-	alpha = (posx - WIDTH / 2) * delta_time / 5;
-	offset_z = (posz - HEIGHT / 2) * delta_time * 120;
+	alpha = (posx - app->cfg.width / 2) * delta_time / 5;
+	offset_z = (posz - app->cfg.height / 2) * delta_time * 120;
 	rotate_camera(app, alpha);
-	if (!(fabs(app->cam.view_z) >= HEIGHT
+	if (!(fabs(app->cam.view_z) >= app->cfg.height
 			&& app->cam.view_z * offset_z > 0))
 		app->cam.view_z += offset_z;
-	mlx_set_mouse_pos(app->mlx, WIDTH / 2, HEIGHT / 2);
+	mlx_set_mouse_pos(app->mlx, app->cfg.width / 2, app->cfg.height / 2);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
 /*   Handles camera movement and rotation each frame.                         */
+/*   In a benchmark run (--bench) the camera follows a scripted path and      */
+/*   every step lasts BENCH_DT, so each run simulates the same frames.        */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -148,12 +146,19 @@ void	move_camera(void *param)
 	current_time = mlx_get_time();
 	delta_time = current_time - last_time;
 	last_time = current_time;
+	if (app->cfg.bench)
+		delta_time = BENCH_DT;
 	check_escape(app);
 	toggle_doors(app);
 	update_door_animation(app, delta_time);
 	update_enemies(app, delta_time);
 	update_weapon_animation(app, delta_time);
 	update_hit_feedback(app, delta_time);
-	update_camera_movement(app, delta_time);
-	update_camera_rotation(app, delta_time);
+	if (app->cfg.bench)
+		bench_camera(app, delta_time);
+	else
+	{
+		update_camera_movement(app, delta_time);
+		update_camera_rotation(app, delta_time);
+	}
 }
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   collision_grid_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:16:44 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:40:53 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Builds the collision grid of the level (`t_solid_grid`) at load time.    */
+/*                                                                            */
+/*   - One cell per map cell, the grid being as wide as the light map (the    */
+/*     longest row; built by `bake_light_map` once the size is known):        */
+/*     SOLID_TILES and the cells past the end of a row are CELL_SOLID, door   */
+/*     cells hold the index of their door, anything else is CELL_FREE.        */
+/*   - Also reserves the movers of the enemies' batched moves.                */
+/*   - Both come from the level arena. Returns -1 if memory runs out.         */
+/*                                                                            */
+/* ************************************************************************** */
+int	build_collision_grid(t_game *g)
+{
+	t_solid_grid	*s;
+	int				i;
+	int				x;
+
+	s = &g->solid;
+	s->w = g->light.w;
+	s->h = g->map_height;
+	s->cell = arena_alloc(&g->arena, s->w * s->h * sizeof(int));
+	g->movers = arena_alloc(&g->arena, (g->enemy_count + 1) * sizeof(t_mover));
+	if (!s->cell || !g->movers)
+		return (printf("Error: Out of memory\n"), -1);
+	i = -1;
+	while (++i < s->w * s->h)
+	{
+		x = i % s->w;
+		s->cell[i] = CELL_SOLID;
+		if (x < (int)ft_strlen(g->map[i / s->w])
+			&& !ft_strchr(SOLID_TILES, g->map[i / s->w][x]))
+			s->cell[i] = CELL_FREE;
+	}
+	i = -1;
+	while (++i < g->door_count)
+		s->cell[g->doors[i].y * s->w + g->doors[i].x] = i;
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns the collision cell (x, y): CELL_FREE, CELL_SOLID or a door       */
+/*   index. Cells outside the map are solid, like in `safe_get_tile`.         */
+/*                                                                            */
+/* ************************************************************************** */
+int	cell_at(const t_game *g, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= g->solid.w || y >= g->solid.h)
+		return (CELL_SOLID);
+	return (g->solid.cell[y * g->solid.w + x]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Moves the circle at `pos` by `delta`, sliding along what it hits.        */
+/*                                                                            */
+/*   - Swept test: the move is split into steps of at most half the           */
+/*     collision radius, so a fast circle cannot jump over a door panel or    */
+/*     a wall corner between two tests.                                       */
+/*   - Each step is tried per axis, x then y. An axis that collides is        */
+/*     dropped for the rest of the move while the other carries on: the       */
+/*     circle slides along a wall instead of stopping dead.                   */
+/*   - Returns true if part of the move was blocked.                          */
+/*                                                                            */
+/* ************************************************************************** */
+bool	move_circle(t_game *g, t_vec2 *pos, t_vec2 delta)
+{
+	t_vec2	step;
+	double	n;
+	bool	blocked;
+
+	n = fmax(1.0, ceil(fmax(fabs(delta.x), fabs(delta.y))
+				/ (COLLISION_RADIUS / 2)));
+	blocked = false;
+	step.x = delta.x / n;
+	step.y = delta.y / n;
+	while (n-- > 0.0 && (step.x != 0.0 || step.y != 0.0))
+	{
+		if (step.x != 0.0 && collides(g, pos->x + step.x, pos->y))
+		{
+			step.x = 0.0;
+			blocked = true;
+		}
+		pos->x += step.x;
+		if (step.y != 0.0 && collides(g, pos->x, pos->y + step.y))
+		{
+			step.y = 0.0;
+			blocked = true;
+		}
+		pos->y += step.y;
+	}
+	return (blocked);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Moves n circles in one call (`move_circle` on each), e.g. every enemy    */
+/*   of the frame. Positions and `blocked` are updated in place.              */
+/*                                                                            */
+/* ************************************************************************** */
+void	move_circles(t_game *g, t_mover *m, int n)
+{
+	int	i;
+
+	i = -1;
+	while (++i < n)
+		m[i].blocked = move_circle(g, &m[i].pos, m[i].delta);
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:17:00 by victor            #+#    #+#             */
-/*   Updated: 2025/04/25 13:36:53 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:19:25 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,21 +18,19 @@
 /*                                                                            */
 /*   - If the position is out of bounds (negative or exceeding map limits),   */
 /*     it returns '1' (wall) to prevent access violations.                    */
-/*   - Uses `ft_strlen` to check the row length dynamically, ensuring         */
-/*     protection against accessing undefined memory.                         */
+/*   - Once the collision grid is built, a cell it does not mark solid lies   */
+/*     inside its row and is read directly: the DDA steps through open cells  */
+/*     in O(1). Door cells hold their orientation in the map (`init_door`).   */
+/*   - Otherwise uses `ft_strlen` to check the row length dynamically,        */
+/*     ensuring protection against accessing undefined memory.                */
 /*                                                                            */
 /* ************************************************************************** */
 char	safe_get_tile(t_game *game, int x, int y)
 {
 	int	len;
-	int	i;
 
-	i = -1;
-	while (++i < game->door_count)
-	{
-		if (game->doors[i].x == x && game->doors[i].y == y)
-			return (game->doors[i].orientation);
-	}
+	if (game->solid.cell && cell_at(game, x, y) != CELL_SOLID)
+		return (game->map[y][x]);
 	if (y < 0 || y >= game->map_height)
 		return ('1');
 	len = ft_strlen(game->map[y]);
@@ -87,44 +85,72 @@ static int	check_cell_collision(double new_x, double new_y,
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Determines whether a given position (new_x, new_y) collides with walls.  */
-/*                                                                            */
-/*   - Initializes a `t_collision` structure to define the player's           */
-/*     bounding area.                                                         */
-/*   - Iterates over the surrounding tiles that could be in contact.          */
-/*   - Calls `safe_get_tile()` to check if a tile is a wall ('1').            */
-/*   - If the tile is a wall, `check_cell_collision()` is used to verify      */
-/*     if the player's circular shape actually overlaps with the wall tile.   */
-/*   - If any tile confirms a collision, it returns `1` (true). Otherwise,    */
-/*     it returns `0` (false).                                                */
+/*   Bounds {x0, y0, x1, y1} of the panel of door `d`, as it is rendered      */
+/*   (see `check_door_collision`): DOOR_DEPTH thick around the middle of      */
+/*   the cell, and shortened by the part of the cell already opened.          */
 /*                                                                            */
 /* ************************************************************************** */
-static int	check_collision(t_game *g, int j, int i, t_vec2 pos)
+static void	door_box(const t_door *d, double *b)
 {
-	int			d;
-	t_collision	c;
-
-	init_collision(&c, pos.x, pos.y);
-	c.j = j;
-	c.i = i;
-	d = -1;
-	while (++d < g->door_count)
+	b[0] = d->x;
+	b[1] = d->y;
+	b[2] = d->x + 1.0;
+	b[3] = d->y + 1.0;
+	if (d->orientation == '2')
 	{
-		if (g->doors[d].x == j && g->doors[d].y == i
-			&& !g->doors[d].is_open
-			&& check_cell_collision(pos.x, pos.y, &c))
-			return (1);
+		b[0] += d->open_offset;
+		b[1] = d->y + 0.5 - DOOR_DEPTH / 2;
+		b[3] = b[1] + DOOR_DEPTH;
 	}
-	return (0);
+	else
+	{
+		b[3] -= d->open_offset;
+		b[0] = d->x + 0.5 - DOOR_DEPTH / 2;
+		b[2] = b[0] + DOOR_DEPTH;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Checks the circle at (x, y) against the panel of door `d`, closest       */
+/*   point on its box like `check_cell_collision()`. The gap of an opening    */
+/*   door is free, and an open door does not block at all.                    */
+/*                                                                            */
+/* ************************************************************************** */
+static int	check_collision(const t_door *d, double x, double y)
+{
+	double	b[4];
+	double	dx;
+	double	dy;
+
+	if (d->open_offset >= 1.0)
+		return (0);
+	door_box(d, b);
+	dx = x - fmax(b[0], fmin(x, b[2]));
+	dy = y - fmax(b[1], fmin(y, b[3]));
+	return (dx * dx + dy * dy < COLLISION_RADIUS * COLLISION_RADIUS);
 }
 
+/* ************************************************************************** */
+/*                                                                            */
+/*   Determines whether a given position (new_x, new_y) collides with walls.  */
+/*                                                                            */
+/*   - Initializes a `t_collision` structure to define the player's           */
+/*     bounding area: the cells the circle's bounding box touches.            */
+/*   - Reads each of them from the collision grid (`cell_at`), one lookup     */
+/*     per cell with no door search.                                          */
+/*   - A solid cell (SOLID_TILES: walls and the partial-height cells one      */
+/*     cannot walk through) is checked with `check_cell_collision()`, a door  */
+/*     cell only where its panel is (`check_collision()`).                    */
+/*   - If any tile confirms a collision, it returns `1` (true). Otherwise,    */
+/*     it returns `0` (false).                                                */
+/*                                                                            */
+/* ************************************************************************** */
 int	collides(t_game *g, double x, double y)
 {
 	t_collision	c;
-	t_vec2		pos;
+	int			k;
 
-	pos.x = x;
-	pos.y = y;
 	init_collision(&c, x, y);
 	c.i = c.min_i - 1;
 	while (++c.i <= c.max_i)
@@ -132,12 +158,9 @@ int	collides(t_game *g, double x, double y)
 		c.j = c.min_j - 1;
 		while (++c.j <= c.max_j)
 		{
-			if (safe_get_tile(g, c.j, c.i) == '1'
-				&& check_cell_collision(x, y, &c))
-				return (1);
-			if ((safe_get_tile(g, c.j, c.i) == '2'
-					|| safe_get_tile(g, c.j, c.i) == '3')
-				&& check_collision(g, c.j, c.i, pos))
+			k = cell_at(g, c.j, c.i);
+			if ((k == CELL_SOLID && check_cell_collision(x, y, &c))
+				|| (k >= 0 && check_collision(&g->doors[k], x, y)))
 				return (1);
 		}
 	}
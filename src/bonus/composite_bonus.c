@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   composite_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:03:14 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:17:40 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Packs a color the way MLX42 stores it in image memory.                   */
+/*                                                                            */
+/*   - Image bytes are R, G, B, A. Read as a (little-endian) uint32 this is   */
+/*     0xAABBGGRR, the opposite of the 0xRRGGBBAA value `mlx_put_pixel` and   */
+/*     `ft_pixel` take. Kernels working on raw pixels use this layout.        */
+/*                                                                            */
+/* ************************************************************************** */
+uint32_t	pack_pixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	return ((uint32_t)a << 24 | (uint32_t)b << 16 | (uint32_t)g << 8 | r);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Linear interpolation of two packed pixels, all four channels at once.    */
+/*                                                                            */
+/*   - `f` is the weight of `b` in [0, 256].                                  */
+/*   - Channels are split in two pairs (bytes 0/2 and 1/3) with the masks     */
+/*     0x00FF00FF, so each 8-bit channel gets a 16-bit lane and the products  */
+/*     (at most 255 * 256) never spill into the neighbour lane.               */
+/*   - Works for any byte order, channels never mix.                          */
+/*                                                                            */
+/* ************************************************************************** */
+uint32_t	lerp_pixel(uint32_t a, uint32_t b, uint32_t f)
+{
+	uint32_t	lo;
+	uint32_t	hi;
+
+	lo = ((a & 0x00FF00FF) * (256 - f) + (b & 0x00FF00FF) * f) >> 8;
+	hi = ((a >> 8) & 0x00FF00FF) * (256 - f) + ((b >> 8) & 0x00FF00FF) * f;
+	return ((lo & 0x00FF00FF) | (hi & 0xFF00FF00));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Fills `n` raw pixels with one packed color (full-screen effects).        */
+/*                                                                            */
+/*   - Effects live in their own window layer and MLX blends them over the    */
+/*     world with the alpha stored in `color`, so no pixel is read back.      */
+/*                                                                            */
+/* ************************************************************************** */
+void	fill_pixels(uint32_t *px, size_t n, uint32_t color)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		px[i] = color;
+		i++;
+	}
+}
@@ -0,0 +1,188 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   config_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:40:15 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:59:21 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Applies one rendering or pacing setting: interleave (0/1, see            */
+/*   render_interleaved), fps (frame rate cap, 0 = none), vsync (0/1),        */
+/*   bench (frames of the scripted benchmark, see `bench_camera`) and simd    */
+/*   (kernel variant, -1 = detect, see `init_kernels`).                       */
+/*   Returns -1 on an unknown key, 0 otherwise.                               */
+/*                                                                            */
+/* ************************************************************************** */
+static int	set_render_option(t_config *cfg, const char *opt, int n)
+{
+	if (!ft_strncmp(opt, "interleave=", 11))
+		cfg->interleave = n != 0;
+	else if (!ft_strncmp(opt, "fps=", 4))
+		cfg->fps = n;
+	else if (!ft_strncmp(opt, "vsync=", 6))
+		cfg->vsync = n != 0;
+	else if (!ft_strncmp(opt, "bench=", 6))
+		cfg->bench = n;
+	else if (!ft_strncmp(opt, "simd=", 5))
+		cfg->simd = n;
+	else
+		return (-1);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Applies one `key=value` setting to the configuration.                    */
+/*                                                                            */
+/*   - Keys: width, height, fov (degrees), minimap (radius in pixels),        */
+/*     minimap_scale (pixels per cell), weapon_scale (percent of the window   */
+/*     height), and the render keys of `set_render_option`.                   */
+/*   - Values must be plain integers.                                         */
+/*   - Returns -1 on an unknown key or a malformed value, 0 otherwise.        */
+/*                                                                            */
+/* ************************************************************************** */
+static int	set_option(t_config *cfg, const char *opt)
+{
+	const char	*val;
+
+	val = ft_strchr(opt, '=');
+	if (!val || !ft_isnumber(val + 1))
+		return (-1);
+	val++;
+	if (!ft_strncmp(opt, "width=", 6))
+		cfg->width = ft_atoi(val);
+	else if (!ft_strncmp(opt, "height=", 7))
+		cfg->height = ft_atoi(val);
+	else if (!ft_strncmp(opt, "fov=", 4))
+		cfg->fov = ft_atoi(val);
+	else if (!ft_strncmp(opt, "minimap=", 8))
+		cfg->mini_radius = ft_atoi(val);
+	else if (!ft_strncmp(opt, "minimap_scale=", 14))
+		cfg->mini_scale = ft_atoi(val);
+	else if (!ft_strncmp(opt, "weapon_scale=", 13))
+		cfg->weapon_scale = ft_atoi(val) / 100.0;
+	else
+		return (set_render_option(cfg, opt, ft_atoi(val)));
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Reads settings from a config file, one `key=value` per line.             */
+/*                                                                            */
+/*   - Empty lines and lines starting with '#' are ignored.                   */
+/*   - Returns -1 if the file cannot be read or a line is invalid.            */
+/*                                                                            */
+/* ************************************************************************** */
+static int	read_config_file(t_config *cfg, const char *path)
+{
+	char	**lines;
+	char	*line;
+	int		count;
+	int		i;
+
+	lines = NULL;
+	count = 0;
+	if (read_lines(path, &lines, &count) == -1)
+		return (printf("Error: Failed to read config %s\n", path), -1);
+	i = -1;
+	while (++i < count)
+	{
+		line = skip_spaces(lines[i]);
+		if (*line == '\0' || *line == '#')
+			continue ;
+		if (set_option(cfg, line) == -1)
+		{
+			printf("Error: Invalid setting in %s: %s\n", path, line);
+			return (free_map_lines(lines, count), -1);
+		}
+	}
+	free_map_lines(lines, count);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Checks the final settings and derives the dependent ones.                */
+/*                                                                            */
+/*   - Window size must lie within MIN/MAX_WIDTH x MIN/MAX_HEIGHT, the FOV    */
+/*     within [30, 150] degrees.                                              */
+/*   - An unset minimap radius follows the window height (h / 10), so the     */
+/*     minimap keeps its proportions from 720p to 4K.                         */
+/*   - The minimap radius must leave room for the player indicator            */
+/*     (MINI_MIN_RADIUS). Minimap center and drawn range follow radius and    */
+/*     scale.                                                                 */
+/*   - A frame rate cap (fps > 0) selects PACE_TARGET and overrides vsync,    */
+/*     otherwise vsync chooses between PACE_VSYNC and PACE_UNCAPPED.          */
+/*                                                                            */
+/* ************************************************************************** */
+static int	check_config(t_config *cfg)
+{
+	if (cfg->width < MIN_WIDTH || cfg->width > MAX_WIDTH
+		|| cfg->height < MIN_HEIGHT || cfg->height > MAX_HEIGHT)
+		return (printf("Error: Resolution must be within %dx%d and %dx%d\n",
+				MIN_WIDTH, MIN_HEIGHT, MAX_WIDTH, MAX_HEIGHT), -1);
+	if (cfg->fov < 30 || cfg->fov > 150)
+		return (printf("Error: FOV must be within 30 and 150 degrees\n"), -1);
+	if (cfg->mini_radius < 0)
+		cfg->mini_radius = cfg->height / 10;
+	if (cfg->mini_radius < MINI_MIN_RADIUS
+		|| cfg->mini_radius > cfg->height / 2 - MINI_MARGIN
+		|| cfg->mini_scale < 1 || cfg->weapon_scale <= 0.0)
+		return (printf("Error: Invalid minimap or weapon settings\n"), -1);
+	cfg->mini_x = cfg->mini_radius + MINI_MARGIN;
+	cfg->mini_y = cfg->mini_radius + MINI_MARGIN;
+	cfg->mini_view_dist = cfg->mini_radius / cfg->mini_scale;
+	if (cfg->fps < 0 || cfg->fps > MAX_FPS || cfg->bench < 0
+		|| cfg->simd < -1 || cfg->simd >= SIMD_LEVELS)
+		return (printf("Error: Invalid fps, bench or simd setting\n"), -1);
+	cfg->pace = PACE_UNCAPPED;
+	if (cfg->vsync)
+		cfg->pace = PACE_VSYNC;
+	if (cfg->fps > 0)
+		cfg->pace = PACE_TARGET;
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Builds the runtime configuration from the arguments following the map.   */
+/*                                                                            */
+/*   - Starts from the DEF_* defaults.                                        */
+/*   - `--config=<file>` loads a config file, `--<key>=<value>` sets a        */
+/*     single value. Options apply in order, so later ones win.               */
+/*   - Returns -1 (after printing the reason) on any invalid option.          */
+/*                                                                            */
+/*   Example: ./cub3D_bonus map.cub --width=1280 --height=720 --fov=90        */
+/*                                                                            */
+/* ************************************************************************** */
+int	load_config(t_config *cfg, int argc, char **argv)
+{
+	int	i;
+
+	*cfg = (t_config){.width = DEF_WIDTH, .height = DEF_HEIGHT,
+		.fov = DEF_FOV, .mini_radius = -1, .mini_scale = DEF_MINI_SCALE,
+		.weapon_scale = DEF_WEAPON_SCALE / 100.0, .fps = DEF_FPS,
+		.vsync = DEF_VSYNC, .simd = DEF_SIMD};
+	i = 1;
+	while (++i < argc)
+	{
+		if (!ft_strncmp(argv[i], "--config=", 9))
+		{
+			if (read_config_file(cfg, argv[i] + 9) == -1)
+				return (-1);
+		}
+		else if (ft_strncmp(argv[i], "--", 2)
+			|| set_option(cfg, argv[i] + 2) == -1)
+			return (printf("Error: Invalid option %s\n", argv[i]), -1);
+	}
+	return (check_config(cfg));
+}
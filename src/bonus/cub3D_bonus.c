@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/04 19:46:33 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 11:45:55 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,18 +14,20 @@
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Validates the command-line arguments. Checks that exactly one argument   */
-/*   is provided and that the file extension is ".cub". Returns EXIT_SUCCESS  */
-/*   if valid, otherwise returns EXIT_FAILURE.                                */
+/*   Validates the command-line arguments. Checks that a map is provided as   */
+/*   first argument and that its extension is ".cub". Any further arguments   */
+/*   are settings (see load_config). Returns EXIT_SUCCESS if valid,           */
+/*   otherwise returns EXIT_FAILURE.                                          */
 /*                                                                            */
 /* ************************************************************************** */
 static int	check_usage(int argc, char **argv)
 {
 	int	len;
 
-	if (argc != 2)
+	if (argc < 2)
 	{
-		printf("Error: Usage: %s <map_file.cub>\n", argv[0]);
+		printf("Error: Usage: %s <map_file.cub> [--config=<file>] "
+			"[--<setting>=<value> ...]\n", argv[0]);
 		return (EXIT_FAILURE);
 	}
 	len = ft_strlen(argv[1]);
@@ -39,27 +41,24 @@ static int	check_usage(int argc, char **argv)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Initializes the MLX instance and creates a new image with the specified  */
-/*   WIDTH and HEIGHT. If any initialization fails, prints an error message   */
-/*   and returns -1. Otherwise, assigns the MLX instance and image to the app */
+/*   Initializes the MLX instance and creates a new image with the configured */
+/*   window size, plus the off-screen world layer used by the render          */
+/*   cache. If any initialization fails, prints an error message and returns  */
+/*   -1. Otherwise, assigns the MLX instance and images to the app. The       */
+/*   images are put in the window by `init_layers`.                           */
 /*                                                                            */
 /* ************************************************************************** */
 static int	init_mlx_and_image(t_app *app)
 {
-	app->mlx = mlx_init(WIDTH, HEIGHT, "cub3D", true);
+	app->mlx = mlx_init(app->cfg.width, app->cfg.height, "cub3D", true);
 	if (!app->mlx)
 	{
 		printf("Error: %s\n", mlx_strerror(mlx_errno));
 		return (-1);
 	}
-	app->image = mlx_new_image(app->mlx, WIDTH, HEIGHT);
-	if (!app->image)
-	{
-		mlx_terminate(app->mlx);
-		printf("Error: %s\n", mlx_strerror(mlx_errno));
-		return (-1);
-	}
-	if (mlx_image_to_window(app->mlx, app->image, 0, 0) == -1)
+	app->image = mlx_new_image(app->mlx, app->cfg.width, app->cfg.height);
+	app->scene = mlx_new_image(app->mlx, app->cfg.width, app->cfg.height);
+	if (!app->image || !app->scene)
 	{
 		mlx_terminate(app->mlx);
 		printf("Error: %s\n", mlx_strerror(mlx_errno));
@@ -70,8 +69,9 @@ static int	init_mlx_and_image(t_app *app)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Sets up the MLX loop hooks for rendering, camera movement, and window    */
-/*   closing. Then enters the MLX main loop.                                  */
+/*   Sets up the MLX loop hooks for the frame pipeline (simulation and        */
+/*   rendering, see `run_frame`) and window closing. Then enters the MLX      */
+/*   main loop.                                                               */
 /*                                                                            */
 /* ************************************************************************** */
 static void	run_loop(t_app *app)
@@ -84,27 +84,30 @@ static void	run_loop(t_app *app)
 		.duration = 0.4
 	};
 	mlx_set_cursor_mode(app->mlx, MLX_MOUSE_HIDDEN);
-	mlx_loop_hook(app->mlx, render_scene, app);
-	mlx_loop_hook(app->mlx, move_camera, app);
+	init_pacer(app);
+	mlx_loop_hook(app->mlx, run_frame, app);
 	mlx_close_hook(app->mlx, close_window, app);
 	mlx_loop(app->mlx);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Entry point of the program. It validates usage, loads the map,           */
-/*   initializes the application and MLX, loads textures, sets camera         */
-/*   parameters, and finally enters the main loop. Cleans up resources before */
-/*   exiting. Camera rot speed and move speed are mesured in units/second.    */
+/*   Entry point of the program. It validates usage and settings, loads the   */
+/*   map, initializes the application, its render buffers and MLX, loads      */
+/*   textures, sets camera parameters, and finally enters the main loop.      */
+/*   Cleans up resources before exiting. Camera rot speed and move speed are  */
+/*   mesured in units/second.                                                 */
 /*                                                                            */
 /* ************************************************************************** */
 int	main(int argc, char **argv)
 {
-	char	**lines;
-	int		line_count;
-	t_app	app;
+	char		**lines;
+	int			line_count;
+	t_config	cfg;
+	t_app		app;
 
-	if (check_usage(argc, argv) != EXIT_SUCCESS)
+	if (check_usage(argc, argv) != EXIT_SUCCESS
+		|| load_config(&cfg, argc, argv) == -1)
 		return (EXIT_FAILURE);
 	lines = NULL;
 	line_count = 0;
@@ -113,11 +116,14 @@ int	main(int argc, char **argv)
 	if (init_app_struct(&app, lines, line_count) != 0)
 		return (EXIT_FAILURE);
 	free_map_lines(lines, line_count);
-	if (init_mlx_and_image(&app) == -1)
+	if (init_render_config(&app, &cfg) == -1 || init_kernels(&app) == -1
+		|| init_mlx_and_image(&app) == -1
+		|| init_layers(&app) == -1 || set_view_scale(&app, 100) == -1)
 		return (EXIT_FAILURE);
-	if (load_game_textures(&app) == -1)
+	if (bake_light_map(&app) == -1 || load_game_textures(&app) == -1
+		|| start_render_thread(&app) == -1)
 		return (EXIT_FAILURE);
-	mlx_set_mouse_pos(app.mlx, WIDTH / 2, HEIGHT / 2);
+	mlx_set_mouse_pos(app.mlx, app.cfg.width / 2, app.cfg.height / 2);
 	run_loop(&app);
-	return (cleanup(&app), EXIT_SUCCESS);
+	return (cleanup(&app));
 }
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 19:49:25 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 12:04:31 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:47:31 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -65,20 +65,32 @@ void	free_map_lines(char **lines, int line_count)
 /* ************************************************************************** */
 /*                                                                            */
 /*   Frees all dynamically allocated resources, including textures,           */
-/*   map data, and MLX-related objects.                                       */
+/*   map data, render buffers and MLX-related objects. The render thread is   */
+/*   stopped first, it may still be drawing with them. With allocation        */
+/*   tracking linked in, the report printed last lists what is still live.    */
+/*   Returns EXIT_FAILURE when that report counted allocations made inside    */
+/*   the frame loop, EXIT_SUCCESS otherwise.                                  */
 /*                                                                            */
 /* ************************************************************************** */
-void	cleanup(t_app *app)
+int	cleanup(t_app *app)
 {
-	int	i;
-
+	stop_render_thread(app);
 	safe_free(app);
-	i = 0;
-	while (i < app->game.map_height)
-	{
-		free(app->game.map[i]);
-		i++;
-	}
-	ft_free(app->game.map);
+	free(app->z_buffer);
+	free(app->cache.cols);
+	free(app->cache.reproj);
+	free(app->cache.slabs);
+	free(app->cache.thins);
+	free(app->bg.sx);
+	free(app->bg.cy);
+	free(app->bg.shade);
+	free(app->rays.cam_x);
+	free(app->rays.dir);
+	free(app->view.fx);
+	free(app->view.fy);
+	free_weapon_cache(&app->weapon);
 	mlx_terminate(app->mlx);
+	if (ft_alloc_report(STDERR_FILENO))
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
 }
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/16 20:51:23 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 12:11:12 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:16:40 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,111 +14,154 @@
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Iterates all doors and checks if the ray hits a closed or opening door.  */
-/*   - Compares ray map coordinates with each door’s grid position.           */
-/*   - If matched, returns 0 when the door is fully open (move_progress>=0.2) */
-/*     else returns 1 to indicate collision.                                  */
-/*   - If no door matches, returns 1 (no blocking door at this hit).          */
+/*   Returns the index of the door in map cell (x, y), or -1 if there is      */
+/*   none.                                                                    */
+/*   - One lookup in the collision grid once it is built; the doors array is  */
+/*     searched only while the level loads.                                   */
 /*                                                                            */
 /* ************************************************************************** */
-int	check_door_collision(t_app *app, t_ray *ray)
+int	find_door(const t_game *g, int x, int y)
 {
 	int	i;
 
-	i = -1;
-	while (++i < app->game.door_count)
+	if (g->solid.cell)
 	{
-		if (app->game.doors[i].x == ray->map_x
-			&& app->game.doors[i].y == ray->map_y)
-			return (!(app->game.doors[i].is_open
-					&& app->game.doors[i].move_progress >= 0.2));
+		i = cell_at(g, x, y);
+		if (i < 0)
+			return (-1);
+		return (i);
 	}
-	return (1);
+	i = 0;
+	while (i < g->door_count && (g->doors[i].x != x || g->doors[i].y != y))
+		i++;
+	if (i == g->door_count)
+		return (-1);
+	return (i);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Advances door animations over time.                                      */
-/*   - For each door with move_progress < DOOR_ANIM_DURATION:                 */
-/*     • Increment move_progress by dt, clamped to duration.                  */
-/*     • Compute t = move_progress / duration in [0,1].                       */
-/*     • If is_open, open_offset = t; otherwise open_offset = 1 - t.          */
-/*   - open_offset is used to interpolate door position in rendering.         */
+/*   Checks whether the ray hits the panel of the door in the cell it just    */
+/*   entered.                                                                 */
+/*   - The panel is a plane in the middle of the cell: y = map_y + 0.5 for    */
+/*     '2', x = map_x + 0.5 for '3' (`mid_plane`).                            */
+/*   - It slides along the plane as the door opens: with `u` the position of  */
+/*     the crossing along the cell, a '2' panel covers u >= open_offset and   */
+/*     a '3' panel u <= 1 - open_offset, like the shifted texture. The ray    */
+/*     goes through the gap (returns 0) to whatever lies behind.              */
+/*   - On a hit, sets the distance and side of the panel and returns 1.       */
 /*                                                                            */
 /* ************************************************************************** */
-void	update_door_animation(t_app *app, double dt)
+int	check_door_collision(t_app *app, t_ray *ray)
 {
-	int		i;
+	t_door	*d;
 	double	t;
-	t_door	*door;
+	double	u;
+	int		i;
 
-	i = -1;
-	while (++i < app->game.door_count)
+	i = find_door(&app->game, ray->map_x, ray->map_y);
+	if (i < 0)
+		return (0);
+	d = &app->game.doors[i];
+	if (!mid_plane(ray, d->orientation == '2', &t))
+		return (0);
+	if (d->orientation == '2')
+		u = app->cam.pos.x + t * ray->raydir.x - ray->map_x;
+	else
+		u = app->cam.pos.y + t * ray->raydir.y - ray->map_y;
+	if ((d->orientation == '2' && u < d->open_offset)
+		|| (d->orientation == '3' && u > 1.0 - d->open_offset))
+		return (0);
+	ray->side = (d->orientation == '2');
+	ray->perpwalldist = t;
+	return (1);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns true if the player or a live enemy overlaps the cell of door d   */
+/*   (the cell grown by COLLISION_RADIUS): closing it would trap them in the  */
+/*   panel.                                                                   */
+/*                                                                            */
+/* ************************************************************************** */
+bool	door_occupied(const t_app *app, const t_door *d)
+{
+	t_vec2	p;
+	int		k;
+
+	k = -1;
+	while (k < app->game.enemy_count)
 	{
-		door = &app->game.doors[i];
-		if (door->move_progress < DOOR_ANIM_DURATION)
-		{
-			door->move_progress += dt;
-			if (door->move_progress > DOOR_ANIM_DURATION)
-				door->move_progress = DOOR_ANIM_DURATION;
-			t = door->move_progress / DOOR_ANIM_DURATION;
-			if (door->is_open)
-				door->open_offset = t;
-			else
-				door->open_offset = 1.0 - t;
-		}
+		p = app->cam.pos;
+		if (k >= 0)
+			p = (t_vec2){app->game.enemies[k].pos_x,
+				app->game.enemies[k].pos_y};
+		if ((k < 0 || app->game.enemies[k].is_active)
+			&& fabs(p.x - d->x - 0.5) < 0.5 + COLLISION_RADIUS
+			&& fabs(p.y - d->y - 0.5) < 0.5 + COLLISION_RADIUS)
+			return (true);
+		k++;
 	}
+	return (false);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Marks a door as opening when activated.                                  */
-/*   - Searches doors matching the ray’s grid coordinates.                    */
-/*   - Sets is_open to true and resets move_progress to 0 to start animating. */
-/*   - Breaks after the first matching door is toggled.                       */
+/*   Returns the index of the door the player is facing within DOOR_REACH,    */
+/*   or -1.                                                                   */
+/*   - Samples the cells along the view direction (the screen center) in      */
+/*     steps of DOOR_REACH / 16 instead of casting a full ray: the walk       */
+/*     stops at the first door or solid cell, at most 1.5 units away.         */
+/*   - The camera is used, not the ray table, which belongs to the render     */
+/*     thread.                                                                */
 /*                                                                            */
 /* ************************************************************************** */
-static void	try_open_door(t_app *app, t_ray *ray)
+static int	door_in_reach(t_app *app)
 {
-	int		i;
-	t_door	*door;
+	double	s;
+	int		x;
+	int		y;
+	char	c;
 
-	i = -1;
-	while (++i < app->game.door_count)
+	s = 0.0;
+	while (s < DOOR_REACH)
 	{
-		door = &app->game.doors[i];
-		if (door->x == ray->map_x && door->y == ray->map_y)
-		{
-			door->is_open = 1;
-			door->move_progress = 0.0;
-			break ;
-		}
+		s += DOOR_REACH / 16;
+		x = (int)(app->cam.pos.x + app->cam.dir.x * s);
+		y = (int)(app->cam.pos.y + app->cam.dir.y * s);
+		c = safe_get_tile(&app->game, x, y);
+		if (c == '2' || c == '3')
+			return (find_door(&app->game, x, y));
+		if (ft_strchr(SOLID_TILES, c))
+			return (-1);
 	}
+	return (-1);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Handles door opening input each frame.                                   */
+/*   Handles door input each frame.                                           */
 /*   - Detects a new Space key press (debounced via last_space).              */
-/*   - Casts a ray from screen center to find a door within 1.5 units.        */
-/*   - If the hit tile is a door identifier ('2' or '3'), calls try_open_door.*/
-/*   - Updates last_space to avoid repeated triggers while held.              */
+/*   - Opens the door in reach (`door_in_reach`) if it is closed or closing,  */
+/*     and closes it if it is open, unless someone stands in its cell.        */
+/*   - The scheduler animates it from there (`set_door_state`).               */
 /*                                                                            */
 /* ************************************************************************** */
 void	toggle_doors(t_app *app)
 {
 	static int	last_space = 0;
 	int			current_space;
-	t_ray		ray;
+	t_door		*d;
+	int			i;
 
 	current_space = mlx_is_key_down(app->mlx, MLX_KEY_SPACE);
+	i = -1;
 	if (current_space && !last_space)
-	{
-		init_ray(app, WIDTH / 2, &ray);
-		do_dda(app, &ray);
-		if (ray.perpwalldist < 1.5
-			&& (ray.hit_tile == '2' || ray.hit_tile == '3'))
-			try_open_door(app, &ray);
-	}
+		i = door_in_reach(app);
 	last_space = current_space;
+	if (i < 0)
+		return ;
+	d = &app->game.doors[i];
+	if (!d->is_open || !door_occupied(app, d))
+		set_door_state(&app->game, i, !d->is_open);
 }
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   door_sched_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:11:31 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:22:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Opens (open = 1) or closes (open = 0) door i.                            */
+/*                                                                            */
+/*   - The animation carries on from the panel's current position: a door     */
+/*     closed halfway through opening slides back from where it is.           */
+/*   - Restarts the auto-close timer (DOOR_AUTO_CLOSE).                       */
+/*   - Adds the door to the scheduler's active set, once: it is sized for     */
+/*     one entry per door. The opened/closed event is queued by `tick_door`   */
+/*     when the motion ends.                                                  */
+/*                                                                            */
+/* ************************************************************************** */
+void	set_door_state(t_game *g, int i, int open)
+{
+	t_door	*d;
+
+	d = &g->doors[i];
+	if (d->is_open == open)
+		return ;
+	d->is_open = open;
+	d->move_progress = d->open_offset * DOOR_ANIM_DURATION;
+	if (!open)
+		d->move_progress = (1.0 - d->open_offset) * DOOR_ANIM_DURATION;
+	d->timer = DOOR_AUTO_CLOSE;
+	if (!d->scheduled)
+		g->door_sched.active[g->door_sched.active_count++] = i;
+	d->scheduled = 1;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Advances door i by dt. Returns false once it is idle (fully closed).     */
+/*                                                                            */
+/*   - While moving: move_progress grows to DOOR_ANIM_DURATION and sets       */
+/*     open_offset (t if opening, 1 - t if closing, t = progress/duration).   */
+/*     Marks the render cache door-dirty so the door's columns are retraced.  */
+/*     When the panel gets fully open or closed, the door is queued (once)    */
+/*     for `dispatch_door_events`, so subscribers see the finished state.     */
+/*   - Once fully open: counts the auto-close timer down, then closes the     */
+/*     door unless the player or an enemy stands in its cell. A blocked door  */
+/*     stays scheduled and tries again on the next frame.                     */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	tick_door(t_app *app, int i, double dt)
+{
+	t_door_sched	*s;
+	t_door			*d;
+
+	s = &app->game.door_sched;
+	d = &app->game.doors[i];
+	if (d->move_progress < DOOR_ANIM_DURATION)
+	{
+		d->move_progress = fmin(d->move_progress + dt, DOOR_ANIM_DURATION);
+		d->open_offset = d->move_progress / DOOR_ANIM_DURATION;
+		if (!d->is_open)
+			d->open_offset = 1.0 - d->open_offset;
+		app->cache.doors_dirty = true;
+		if (d->move_progress < DOOR_ANIM_DURATION || d->queued)
+			return (true);
+		s->events[s->event_count++] = i;
+		d->queued = 1;
+		return (true);
+	}
+	if (!d->is_open)
+		return (false);
+	d->timer -= dt;
+	if (d->timer <= 0.0 && !door_occupied(app, d))
+		set_door_state(&app->game, i, 0);
+	return (true);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Ticks the doors of the active set (`tick_door`); idle doors are never    */
+/*   visited, so the cost scales with the doors that move or wait to close.   */
+/*                                                                            */
+/*   - A door that went idle is swapped with the last entry and dropped; the  */
+/*     swapped-in door is ticked in the same pass.                            */
+/*   - Doors enter the set through `set_door_state`.                          */
+/*                                                                            */
+/* ************************************************************************** */
+void	update_door_animation(t_app *app, double dt)
+{
+	t_door_sched	*s;
+	int				k;
+
+	s = &app->game.door_sched;
+	k = 0;
+	while (k < s->active_count)
+	{
+		if (tick_door(app, s->active[k], dt))
+			k++;
+		else
+		{
+			app->game.doors[s->active[k]].scheduled = 0;
+			s->active[k] = s->active[--s->active_count];
+		}
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Sends the doors that finished opening or closing since the last call to  */
+/*   the systems that depend on the door state, then empties the queue.       */
+/*                                                                            */
+/*   - Subscribers: the light map (`door_light_event`) and the minimap        */
+/*     (`door_minimap_event`). A new one is added to `handlers`.              */
+/*   - Handlers only update the live app; `snapshot_state` carries what       */
+/*     they flag into the render context.                                     */
+/*   - A door that changed twice is reported once, in its current state.      */
+/*                                                                            */
+/* ************************************************************************** */
+void	dispatch_door_events(t_app *app)
+{
+	static const t_door_handler	handlers[] = {door_light_event,
+		door_minimap_event};
+	t_door_sched				*s;
+	t_door						*d;
+	size_t						h;
+	int							k;
+
+	s = &app->game.door_sched;
+	k = -1;
+	while (++k < s->event_count)
+	{
+		d = &app->game.doors[s->events[k]];
+		d->queued = 0;
+		h = 0;
+		while (h < sizeof(handlers) / sizeof(*handlers))
+			handlers[h++](app, d);
+	}
+	s->event_count = 0;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Minimap subscriber: door cells change colour when a door opens or        */
+/*   closes, so the minimap layer is flagged for the next frame.              */
+/*                                                                            */
+/* ************************************************************************** */
+void	door_minimap_event(t_app *app, const t_door *d)
+{
+	(void)d;
+	app->layers.dirty[LAYER_MINIMAP] = true;
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 14:53:46 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 12:16:53 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:32:16 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,81 +31,78 @@ void	update_hit_feedback(t_app *app, double dt)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Blends two ARGB colors with a given alpha.                               */
-/*   - base and overlay are 0xAARRGGBB values.                                */
-/*   - alpha in [0,255] is strength of overlay.                               */
-/*   - Computes r,g,b = base*(1−a)+overlay*a; returns 0xFFRRGGBB.             */
+/*   Returns the opacity of the red hit overlay for this frame.               */
+/*   - 0 if no feedback is active.                                            */
+/*   - prog = timer / duration gives fade progress.                           */
+/*   - alpha = (1 - prog) * 120 for overlay strength.                         */
 /*                                                                            */
 /* ************************************************************************** */
-static uint32_t	blend_colors(uint32_t base, uint32_t overlay, int alpha)
+int	hit_feedback_alpha(const t_app *app)
 {
-	float	a;
-	uint8_t	r;
-	uint8_t	g;
-	uint8_t	b;
+	double	prog;
 
-	a = alpha / 255.0f;
-	r = (uint8_t)(((base >> 16) & 0xFF) * (1.0f - a)
-			+ ((overlay >> 16) & 0xFF) * a);
-	g = (uint8_t)(((base >> 8) & 0xFF) * (1.0f - a)
-			+ ((overlay >> 8) & 0xFF) * a);
-	b = (uint8_t)(((base) & 0xFF) * (1.0f - a)
-			+ ((overlay) & 0xFF) * a);
-	return ((0xFF << 24) | (r << 16) | (g << 8) | b);
+	if (!app->player_hit_feedback.active)
+		return (0);
+	prog = app->player_hit_feedback.timer
+		/ app->player_hit_feedback.duration;
+	return ((int)((1.0 - prog) * 120));
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Applies a red tint overlay to the entire image when hit.                 */
-/*   - Skips if no feedback active.                                           */
-/*   - prog = timer / duration gives fade progress.                           */
-/*   - alpha = (1 - prog) * 120 for overlay strength.                         */
-/*   - Blends each pixel with red_overlay using blend_colors.                 */
+/*   Draws the red hit overlay into the effects layer.                        */
+/*   - The layer is hidden while no feedback is active.                       */
+/*   - Otherwise it is filled with the overlay color at the current opacity   */
+/*     and MLX blends it over the layers below.                               */
 /*                                                                            */
 /* ************************************************************************** */
 void	render_hit_feedback(t_app *app)
 {
+	mlx_image_t	*img;
 	int			alpha;
-	double		prog;
-	uint32_t	red_overlay;
-	uint32_t	*p;
-	uint32_t	*end;
 
-	if (!app->player_hit_feedback.active)
-		return ;
-	prog = app->player_hit_feedback.timer
-		/ app->player_hit_feedback.duration;
-	alpha = (int)((1.0 - prog) * 120);
-	red_overlay = 0x002222CC;
-	p = (uint32_t *)app->image->pixels;
-	end = p + app->image->width * app->image->height;
-	while (p < end)
-	{
-		*p = blend_colors(*p, red_overlay, alpha);
-		p++;
-	}
+	img = app->layers.img[LAYER_EFFECTS];
+	alpha = hit_feedback_alpha(app);
+	app->layers.effect_alpha = alpha;
+	img->enabled = (alpha > 0);
+	if (alpha > 0)
+		fill_pixels((uint32_t *)img->pixels,
+			(size_t)img->width * img->height,
+			pack_pixel(0xCC, 0x22, 0x22, alpha));
 }
 
 /* ************************************************************************** */
 /*                                                                            */
 /*   Updates all enemies each frame.                                          */
 /*   - Calls apply_hit_to_enemy to register hits on enemies.                  */
-/*   - For each active enemy, invokes update_enemy with camera and delta_time */
+/*   - Refreshes the update tier (`update_lod`) and the cached line of sight  */
+/*     (`update_sight`) of a few of them.                                     */
+/*   - For each active enemy whose tier updates it this tick (`lod_tick`),    */
+/*     invokes update_enemy with camera and the time step of its tier. The    */
+/*     others request no move.                                                */
+/*   - Then moves them all in two batches (`move_enemies`): the steps they    */
+/*     requested, then the pushes that keep them off the camera.              */
 /*                                                                            */
 /* ************************************************************************** */
 void	update_enemies(t_app *app, double delta_time)
 {
-	t_camera	*cam;
-	int			i;
+	t_enemy	*e;
+	double	dt;
+	int		i;
 
 	apply_hit_to_enemy(app);
-	cam = &app->cam;
+	update_lod(app);
+	update_sight(app);
 	i = -1;
 	while (++i < app->game.enemy_count)
 	{
-		if (app->game.enemies[i].is_active)
-			update_enemy(app, &app->game.enemies[i], cam, delta_time);
+		e = &app->game.enemies[i];
+		e->step = (t_vec2){0.0, 0.0};
+		if (e->is_active && lod_tick(e, delta_time, &dt))
+			update_enemy(app, e, &app->cam, dt);
 	}
+	move_enemies(app, false);
+	move_enemies(app, true);
 }
 
 /* ************************************************************************** */
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   enemy_anim_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:36:13 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:41:55 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Copies the clip of every enemy state and gives each one its slice of     */
+/*   the rect table. Returns the number of rects.                             */
+/*                                                                            */
+/*   - MOVE walks down rows 0..3 in the column of the facing side, looping.   */
+/*   - ATTACK swings through row 4, columns 0..1, then cools down in walk     */
+/*     row 2 before moving again.                                             */
+/*   - HIT flinches on row 4, column 2; DEAD falls through columns 2..4 and   */
+/*     holds the last frame.                                                  */
+/*                                                                            */
+/* ************************************************************************** */
+static int	load_clips(t_enemy_anim *a)
+{
+	static const t_anim_clip	clips[ENEMY_STATES] = {
+	[ENEMY_MOVE] = {.sided = true, .row = 0, .count = 4, .time = 0.125,
+		.next = ANIM_LOOP},
+	[ENEMY_ATTACK] = {.row = 4, .col = 0, .count = 2, .time = 0.15,
+		.next = ENEMY_COOLDOWN},
+	[ENEMY_COOLDOWN] = {.sided = true, .row = 2, .count = 1, .time = 0.6,
+		.next = ENEMY_MOVE},
+	[ENEMY_HIT] = {.row = 4, .col = 2, .count = 1, .time = 0.2,
+		.next = ENEMY_MOVE},
+	[ENEMY_DEAD] = {.row = 4, .col = 2, .count = 3, .time = 0.175,
+		.next = ANIM_HOLD}};
+	int							n;
+	int							s;
+
+	ft_memcpy(a->clips, clips, sizeof(clips));
+	n = 0;
+	s = -1;
+	while (++s < ENEMY_STATES)
+	{
+		a->clips[s].base = n;
+		n += a->clips[s].count * ENEMY_SIDES;
+	}
+	return (n);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Precomputes the atlas rect of every clip frame from every side.          */
+/*   - Sided clips take the column of the side (the right-hand sides reuse    */
+/*     the left-hand columns, mirrored) and one row per frame.                */
+/*   - The others step along their row and are never mirrored.                */
+/*                                                                            */
+/* ************************************************************************** */
+static void	fill_rects(t_enemy_anim *a)
+{
+	static const int	side_col[ENEMY_SIDES] = {0, 1, 2, 3, 4, 3, 2, 1};
+	const t_anim_clip	*c;
+	t_anim_rect			*r;
+	int					s;
+	int					k;
+
+	s = -1;
+	while (++s < ENEMY_STATES)
+	{
+		c = &a->clips[s];
+		k = -1;
+		while (++k < c->count * ENEMY_SIDES)
+		{
+			r = &a->rects[c->base + k];
+			r->x = (c->col + k / ENEMY_SIDES) * a->w;
+			r->y = c->row * a->h;
+			r->flip = false;
+			if (!c->sided)
+				continue ;
+			r->x = side_col[k % ENEMY_SIDES] * a->w;
+			r->y = (c->row + k / ENEMY_SIDES) * a->h;
+			r->flip = (k % ENEMY_SIDES >= FRONT_RIGHT
+					&& k % ENEMY_SIDES <= BACK_RIGHT);
+		}
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Compiles the enemy clips into `enemy_anim` once the enemy atlas is       */
+/*   loaded (ENEMY_ATLAS x ENEMY_ATLAS frames). The rects live in the level   */
+/*   arena; without an atlas they stay empty but the clips still time the     */
+/*   states.                                                                  */
+/*                                                                            */
+/* ************************************************************************** */
+int	build_enemy_anim(t_app *app)
+{
+	t_enemy_anim	*a;
+	int				n;
+
+	a = &app->game.enemy_anim;
+	n = load_clips(a);
+	a->rects = arena_alloc(&app->game.arena, n * sizeof(t_anim_rect));
+	if (!a->rects)
+		return (printf("Error: Out of memory\n"), cleanup(app), -1);
+	if (app->game.tex_enemy)
+	{
+		a->w = app->game.tex_enemy->width / ENEMY_ATLAS;
+		a->h = app->game.tex_enemy->height / ENEMY_ATLAS;
+	}
+	fill_rects(a);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Switches `e` to `state` and restarts its clip.                           */
+/*                                                                            */
+/* ************************************************************************** */
+void	set_enemy_state(t_enemy *e, int state)
+{
+	e->e_state = state;
+	e->anim_frame = 0;
+	e->anim_timer = 0.0;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Advances the animation of `e` by dt, and its knockback and hit flash.    */
+/*   Every state runs the same loop over its clip: each `time` spent moves    */
+/*   to the next frame, and past the last one the clip loops, holds, or       */
+/*   hands over to its `next` state.                                          */
+/*                                                                            */
+/* ************************************************************************** */
+void	animate_enemy(const t_enemy_anim *a, t_enemy *e, double dt)
+{
+	const t_anim_clip	*c;
+
+	if (e->knockback_time > 0)
+		e->knockback_time -= dt;
+	if (e->hit_flash > 0)
+		e->hit_flash--;
+	c = &a->clips[e->e_state];
+	e->anim_timer += dt;
+	while (e->anim_timer >= c->time)
+	{
+		e->anim_timer -= c->time;
+		if (++e->anim_frame < c->count)
+			continue ;
+		e->anim_frame = 0;
+		if (c->next == ANIM_HOLD)
+		{
+			e->anim_frame = c->count - 1;
+			e->anim_timer = 0.0;
+		}
+		else if (c->next != ANIM_LOOP)
+			set_enemy_state(e, c->next);
+		c = &a->clips[e->e_state];
+	}
+}
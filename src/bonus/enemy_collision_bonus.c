@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   enemy_collision_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:17:58 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:32:16 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Compute push vector to separate enemy and camera on collision overlap.   */
+/*   - ax,ay: vector from camera to enemy.                                    */
+/*   - dist_sq: squared distance.                                             */
+/*   - min_dist: sum of radii for no-overlap.                                 */
+/*   - If dist_sq < min_dist² and >0:                                         */
+/*       • dist = sqrt(dist_sq).                                              */
+/*       • push = unit(ax,ay)*(min_dist–dist+0.001).                          */
+/*   - Else push = (0,0).                                                     */
+/*                                                                            */
+/* ************************************************************************** */
+static void	calculate_push(t_enemy *e, t_camera *cam,
+		double *push_x, double *push_y)
+{
+	double	ax;
+	double	ay;
+	double	dist_sq;
+	double	min_dist;
+	double	dist;
+
+	ax = e->pos_x - cam->pos.x;
+	ay = e->pos_y - cam->pos.y;
+	dist_sq = ax * ax + ay * ay;
+	min_dist = e->radius + COLLISION_RADIUS;
+	if (dist_sq < (min_dist * min_dist) && dist_sq > 1e-8)
+	{
+		dist = sqrt(dist_sq);
+		*push_x = (ax / dist) * (min_dist - dist + 0.001);
+		*push_y = (ay / dist) * (min_dist - dist + 0.001);
+	}
+	else
+	{
+		*push_x = 0.0;
+		*push_y = 0.0;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Fills the movers of the active enemies that are awake (`update_lod`),    */
+/*   in `app->game.movers`, and returns their count.                          */
+/*   - The move is the step the enemy requested this frame, or with `push`    */
+/*     the push that separates it from the camera (`calculate_push`).         */
+/*                                                                            */
+/* ************************************************************************** */
+static int	gather_movers(t_app *app, bool push)
+{
+	t_mover	*m;
+	t_enemy	*e;
+	int		n;
+	int		i;
+
+	n = 0;
+	i = -1;
+	while (++i < app->game.enemy_count)
+	{
+		e = &app->game.enemies[i];
+		if (e->is_active && e->lod != LOD_DORMANT)
+		{
+			m = &app->game.movers[n++];
+			m->id = i;
+			m->pos = (t_vec2){e->pos_x, e->pos_y};
+			m->delta = e->step;
+			if (push)
+				calculate_push(e, &app->cam, &m->delta.x, &m->delta.y);
+		}
+	}
+	return (n);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Moves every awake enemy in one batched call (`move_circles`).            */
+/*                                                                            */
+/*   - Without `push`: the steps requested by `move_towards_cam` and          */
+/*     `process_knockback`. Enemies slide along walls instead of stopping,    */
+/*     which removes their jitter against them.                               */
+/*   - With `push`: separates enemies from the camera. The part of a push a   */
+/*     wall stopped moves the camera back instead, itself stopped by walls.   */
+/*                                                                            */
+/* ************************************************************************** */
+void	move_enemies(t_app *app, bool push)
+{
+	t_mover	*m;
+	t_enemy	*e;
+	t_vec2	rest;
+	int		n;
+
+	n = gather_movers(app, push);
+	move_circles(&app->game, app->game.movers, n);
+	while (n-- > 0)
+	{
+		m = &app->game.movers[n];
+		e = &app->game.enemies[m->id];
+		rest.x = e->pos_x + m->delta.x - m->pos.x;
+		rest.y = e->pos_y + m->delta.y - m->pos.y;
+		e->pos_x = m->pos.x;
+		e->pos_y = m->pos.y;
+		if (push && m->blocked)
+			move_circle(&app->game, &app->cam.pos,
+				(t_vec2){-rest.x, -rest.y});
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/20 22:50:54 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 12:25:50 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:41:55 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,38 +15,31 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*   Applies ongoing knockback to an enemy based on its knockback_dir.        */
-/*   - Computes new position = pos + knockback_dir * (2.5 * dt).              */
-/*   - Checks collision; only updates pos if space is free.                   */
+/*   - Requests the step knockback_dir * (2.5 * dt); it is moved with the     */
+/*     other enemies (`move_enemies`), sliding along walls.                   */
 /*                                                                            */
 /* ************************************************************************** */
-void	process_knockback(t_app *a, t_enemy *e, double dt)
+void	process_knockback(t_enemy *e, double dt)
 {
-	double			new_x;
-	double			new_y;
 	const double	force = 2.5 * dt;
 
-	new_x = e->pos_x + e->knockback_dir.x * force;
-	new_y = e->pos_y + e->knockback_dir.y * force;
-	if (!collides(&a->game, new_x, new_y))
-	{
-		e->pos_x = new_x;
-		e->pos_y = new_y;
-	}
+	e->step.x = e->knockback_dir.x * force;
+	e->step.y = e->knockback_dir.y * force;
 }
 
 /* ************************************************************************** */
 /*                                                                            */
 /*   Applies immediate knockback when an enemy is hit.                        */
-/*   - Normalizes hit_dir and moves enemy by 0.3 units along that vector.     */
-/*   - On no collision, updates pos and sets hit_flash, knockback_time (0.2). */
+/*   - Normalizes hit_dir and moves enemy by 0.3 units along that vector,     */
+/*     as far as walls allow (`move_circle`).                                 */
+/*   - Sets hit_flash, knockback_time (0.2).                                  */
 /*   - Stores normalized knockback_dir for subsequent process_knockback calls */
 /*                                                                            */
 /* ************************************************************************** */
 static void	apply_knockback(t_app *app, t_enemy *e, t_vec2 hit_dir)
 {
 	double	length;
-	double	new_x;
-	double	new_y;
+	t_vec2	pos;
 
 	length = sqrt(hit_dir.x * hit_dir.x + hit_dir.y * hit_dir.y);
 	if (length > 0)
@@ -54,13 +47,11 @@ static void	apply_knockback(t_app *app, t_enemy *e, t_vec2 hit_dir)
 		hit_dir.x /= length;
 		hit_dir.y /= length;
 	}
-	new_x = e->pos_x + hit_dir.x * 0.3;
-	new_y = e->pos_y + hit_dir.y * 0.3;
-	if (!collides(&app->game, new_x, new_y))
-	{
-		e->pos_x = new_x;
-		e->pos_y = new_y;
-	}
+	pos = (t_vec2){e->pos_x, e->pos_y};
+	move_circle(&app->game, &pos,
+		(t_vec2){hit_dir.x * 0.3, hit_dir.y * 0.3});
+	e->pos_x = pos.x;
+	e->pos_y = pos.y;
 	e->hit_flash = 5;
 	e->knockback_time = 0.2;
 	e->knockback_dir = hit_dir;
@@ -72,7 +63,7 @@ static void	apply_knockback(t_app *app, t_enemy *e, t_vec2 hit_dir)
 /*   - Computes distance from camera to enemy; skips if >=1.2 units.          */
 /*   - Calls apply_knockback with vector from player to enemy.                */
 /*   - Increments hit_count; if >=3 and not already dead, switches to DEAD.   */
-/*   - Otherwise sets state to HIT and resets anim_frame/timer.               */
+/*   - Otherwise switches to HIT, restarting the clip (`set_enemy_state`).    */
 /*                                                                            */
 /* ************************************************************************** */
 static void	process_hit_on_enemy(t_app *app, t_enemy *e)
@@ -91,17 +82,9 @@ static void	process_hit_on_enemy(t_app *app, t_enemy *e)
 	apply_knockback(app, e, hit_dir);
 	e->hit_count++;
 	if (e->hit_count >= 3 && e->e_state != ENEMY_DEAD)
-	{
-		e->e_state = ENEMY_DEAD;
-		e->anim_frame = 2;
-		e->anim_timer = 0;
-	}
+		set_enemy_state(e, ENEMY_DEAD);
 	else
-	{
-		e->e_state = ENEMY_HIT;
-		e->anim_frame = 2;
-		e->anim_timer = 0.0;
-	}
+		set_enemy_state(e, ENEMY_HIT);
 }
 
 /* ************************************************************************** */
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   enemy_lod_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:28:41 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:32:16 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Sorts LOD_PER_TICK enemies per tick, round robin from `lod_next`, into   */
+/*   update tiers by their distance d to the player:                          */
+/*                                                                            */
+/*   - LOD_NEAR (every tick): d <= ENEMY_NEAR, or the enemy sees the player   */
+/*     (so nothing on screen chases in steps).                                */
+/*   - LOD_FAR (every ENEMY_FAR_STEP seconds): up to ENEMY_WAKE.              */
+/*   - LOD_DORMANT (never): beyond ENEMY_WAKE. New enemies start dormant and  */
+/*     wake when a pass finds the player close enough; the time they slept    */
+/*     is not simulated.                                                      */
+/*                                                                            */
+/*   Only a distance is computed per visit, so every enemy can be revisited   */
+/*   within a few ticks even on crowded maps.                                 */
+/*                                                                            */
+/* ************************************************************************** */
+void	update_lod(t_app *app)
+{
+	t_enemy	*e;
+	double	d;
+	int		n;
+
+	n = 0;
+	while (n++ < LOD_PER_TICK && n <= app->game.enemy_count)
+	{
+		if (app->game.lod_next >= app->game.enemy_count)
+			app->game.lod_next = 0;
+		e = &app->game.enemies[app->game.lod_next++];
+		d = hypot(e->pos_x - app->cam.pos.x, e->pos_y - app->cam.pos.y);
+		if (e->lod == LOD_DORMANT)
+			e->lod_dt = 0.0;
+		e->lod = LOD_FAR;
+		if (d <= ENEMY_NEAR || e->sees_player)
+			e->lod = LOD_NEAR;
+		else if (d > ENEMY_WAKE)
+			e->lod = LOD_DORMANT;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Tells whether enemy `e` is updated this tick, and with which time step.  */
+/*                                                                            */
+/*   - Dormant enemies are skipped.                                           */
+/*   - The others bank dt in `lod_dt`; a near enemy spends it every tick, a   */
+/*     far one once ENEMY_FAR_STEP has built up, so it moves and animates at  */
+/*     the same speed with fewer updates.                                     */
+/*   - Returns true and sets *step to the time to simulate if it updates.     */
+/*                                                                            */
+/* ************************************************************************** */
+bool	lod_tick(t_enemy *e, double dt, double *step)
+{
+	if (e->lod == LOD_DORMANT)
+		return (false);
+	e->lod_dt += dt;
+	if (e->lod == LOD_FAR && e->lod_dt < ENEMY_FAR_STEP)
+		return (false);
+	*step = e->lod_dt;
+	e->lod_dt = 0.0;
+	return (true);
+}
@@ -6,113 +6,36 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/20 22:23:00 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 12:31:48 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:27:32 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3D_bonus.h"
 
-/* ************************************************************************** */
-/*                                                                            */
-/*   Compute push vector to separate enemy and camera on collision overlap.   */
-/*   - ax,ay: vector from camera to enemy.                                    */
-/*   - dist_sq: squared distance.                                             */
-/*   - min_dist: sum of radii for no-overlap.                                 */
-/*   - If dist_sq < min_dist² and >0:                                         */
-/*       • dist = sqrt(dist_sq).                                              */
-/*       • push = unit(ax,ay)*(min_dist–dist+0.001).                          */
-/*   - Else push = (0,0).                                                     */
-/*                                                                            */
-/* ************************************************************************** */
-static void	calculate_push(t_enemy *e, t_camera *cam,
-		double *push_x, double *push_y)
-{
-	double	ax;
-	double	ay;
-	double	dist_sq;
-	double	min_dist;
-	double	dist;
-
-	ax = e->pos_x - cam->pos.x;
-	ay = e->pos_y - cam->pos.y;
-	dist_sq = ax * ax + ay * ay;
-	min_dist = e->radius + COLLISION_RADIUS;
-	if (dist_sq < (min_dist * min_dist) && dist_sq > 1e-8)
-	{
-		dist = sqrt(dist_sq);
-		*push_x = (ax / dist) * (min_dist - dist + 0.001);
-		*push_y = (ay / dist) * (min_dist - dist + 0.001);
-	}
-	else
-	{
-		*push_x = 0.0;
-		*push_y = 0.0;
-	}
-}
-
-/* ************************************************************************** */
-/*                                                                            */
-/*   Resolve enemy vs camera collision by applying push with collision check. */
-/*   - Get push_x,push_y from calculate_push.                                 */
-/*   - If non-zero push:                                                      */
-/*       • Save original pos.                                                 */
-/*       • Move enemy by push.                                                */
-/*       • If collides with map, revert enemy pos and push camera back.       */
-/*                                                                            */
-/* ************************************************************************** */
-void	handle_enemy_collision(t_app *app, t_enemy *e, t_camera *cam)
-{
-	double	push_x;
-	double	push_y;
-	double	orig_x;
-	double	orig_y;
-
-	calculate_push(e, cam, &push_x, &push_y);
-	if (push_x != 0.0 || push_y != 0.0)
-	{
-		orig_x = e->pos_x;
-		orig_y = e->pos_y;
-		e->pos_x += push_x;
-		e->pos_y += push_y;
-		if (collides(&app->game, e->pos_x, e->pos_y))
-		{
-			e->pos_x = orig_x;
-			e->pos_y = orig_y;
-			cam->pos.x -= push_x;
-			cam->pos.y -= push_y;
-		}
-	}
-}
-
 /* ************************************************************************** */
 /*                                                                            */
 /*   Move enemy toward camera within range limits.                            */
 /*   - Compute dx,dy and distance to camera.                                  */
-/*   - Skip if distance <1 or >10 units.                                      */
-/*   - Compute move_x,move_y using facing_angle and speed*dt.                 */
-/*   - If new pos not colliding, apply move.                                  */
+/*   - Skip if distance <1 or >10 units (ENEMY_SIGHT), or if the enemy did    */
+/*     not see the player at its last sight check (`update_sight`).           */
+/*   - Compute the step using facing_angle and speed*dt.                      */
+/*   - Requests that step; it is moved with the other enemies                 */
+/*     (`move_enemies`), sliding along walls.                                 */
 /*                                                                            */
 /* ************************************************************************** */
-void	move_towards_cam(t_app *app, t_enemy *e, t_camera *cam, double dt)
+void	move_towards_cam(t_enemy *e, t_camera *cam, double dt)
 {
 	double	dx;
 	double	dy;
 	double	distance;
-	double	move_x;
-	double	move_y;
 
 	dx = cam->pos.x - e->pos_x;
 	dy = cam->pos.y - e->pos_y;
 	distance = sqrt(dx * dx + dy * dy);
-	if (distance < 1.0 || distance > 10.0)
+	if (distance < 1.0 || distance > ENEMY_SIGHT || !e->sees_player)
 		return ;
-	move_x = cos(e->facing_angle) * e->speed * dt;
-	move_y = sin(e->facing_angle) * e->speed * dt;
-	if (!collides(&app->game, e->pos_x + move_x, e->pos_y + move_y))
-	{
-		e->pos_x += move_x;
-		e->pos_y += move_y;
-	}
+	e->step.x = cos(e->facing_angle) * e->speed * dt;
+	e->step.y = sin(e->facing_angle) * e->speed * dt;
 }
 
 /* ************************************************************************** */
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_tex_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:30:46 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 15:54:57 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Converts a loaded texture for the floor and ceiling spans.               */
+/*                                                                            */
+/*   - The side is the largest power of two that fits the texture, capped to  */
+/*     2^FLAT_TEX_MAX_BITS to keep the texels cache friendly; the pixels are  */
+/*     resampled (nearest) into a square so both coordinates wrap with one    */
+/*     mask.                                                                  */
+/*   - MLX pixels already have the byte order of the scene image, so texels   */
+/*     are copied as raw 32-bit words.                                        */
+/*   - The texels live in the level arena. Returns -1 if it is out of memory. */
+/*                                                                            */
+/* ************************************************************************** */
+static int	convert_flat(t_game *g, const mlx_texture_t *tex, t_flat_tex *out)
+{
+	const uint32_t	*src;
+	int				side;
+	int				x;
+	int				y;
+
+	out->bits = 0;
+	while ((2u << out->bits) <= tex->width && (2u << out->bits) <= tex->height
+		&& out->bits < FLAT_TEX_MAX_BITS)
+		out->bits++;
+	side = 1 << out->bits;
+	out->px = arena_alloc(&g->arena, side * side * sizeof(uint32_t));
+	if (!out->px)
+		return (-1);
+	src = (const uint32_t *)tex->pixels;
+	y = -1;
+	while (++y < side)
+	{
+		x = -1;
+		while (++x < side)
+			out->px[y * side + x] = src[(y * tex->height / side) * tex->width
+				+ x * tex->width / side];
+	}
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Loads one floor or ceiling texture and converts it; the MLX texture is   */
+/*   released right away since only the converted texels are drawn.           */
+/*                                                                            */
+/* ************************************************************************** */
+static int	load_flat(t_game *g, const char *path, t_flat_tex *out)
+{
+	mlx_texture_t	*tex;
+	int				ret;
+
+	tex = mlx_load_png(path);
+	if (!tex)
+		return (-1);
+	ret = convert_flat(g, tex, out);
+	mlx_delete_texture(tex);
+	return (ret);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Loads the optional floor (FT) and ceiling (CT) textures.                 */
+/*                                                                            */
+/*   - Without them the floor and ceiling keep their flat colors (F, C).      */
+/*   - If a texture fails to load, prints error, calls cleanup, returns -1.   */
+/*                                                                            */
+/* ************************************************************************** */
+int	load_flat_textures(t_app *app)
+{
+	t_game	*g;
+
+	g = &app->game;
+	if (g->texture_floor && load_flat(g, g->texture_floor, &g->floor_tex) == -1)
+		return (printf("Error\nFloor texture\n"), cleanup(app), -1);
+	if (g->texture_ceil && load_flat(g, g->texture_ceil, &g->ceil_tex) == -1)
+		return (printf("Error\nCeiling texture\n"), cleanup(app), -1);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Texel of a floor or ceiling texture at world point (x, y); one texture   */
+/*   covers one map cell.                                                     */
+/*                                                                            */
+/* ************************************************************************** */
+uint32_t	flat_texel(const t_flat_tex *t, double x, double y)
+{
+	int	m;
+
+	m = (1 << t->bits) - 1;
+	return (t->px[(((int)floor(y * (m + 1)) & m) << t->bits)
+		| ((int)floor(x * (m + 1)) & m)]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws a textured floor or ceiling scanline (columns [span[0], span[1])). */
+/*                                                                            */
+/*   - r = H / (2 * |y - horizon|) is the distance of the scanline, as in     */
+/*     draw_floor and draw_ceiling (the horizon row itself is taken as half a */
+/*     row away). Rows above the horizon use the ceiling texture.             */
+/*   - The world point of column x is pos + r * dir[x] and dir[x] moves by    */
+/*     plane * 2 / w per column (see update_ray_table), so the texture        */
+/*     coordinates are set up once per row and stepped by `flat_span`:        */
+/*       u = world.x * side, du = r * plane.x * 2 / w * side (same for v)     */
+/*   - Shade rows come from shade_span, like the untextured scanlines.        */
+/*                                                                            */
+/* ************************************************************************** */
+void	draw_flat_span(t_app *app, int y, const int *span)
+{
+	const t_flat_tex	*t;
+	t_span_job			j;
+	double				side;
+	double				r;
+
+	t = &app->game.floor_tex;
+	if (y < (int)(app->view.h / 2 - app->view.z))
+		t = &app->game.ceil_tex;
+	r = app->view.h / (2.0 * fmax(fabs(y - (app->view.h / 2 - app->view.z)),
+				0.5));
+	shade_span(app, r, span, app->bg.shade);
+	side = (1 << t->bits) * 65536.0;
+	j.dst = (uint32_t *)app->scene->pixels + y * app->scene->width + span[0];
+	j.tex = t->px;
+	j.shade = app->bg.shade + span[0];
+	j.mul = app->shade.mul;
+	j.w = span[1] - span[0];
+	j.bits = t->bits;
+	j.u = (int64_t)((app->cam.pos.x + r * app->rays.dir[span[0]].x) * side);
+	j.v = (int64_t)((app->cam.pos.y + r * app->rays.dir[span[0]].y) * side);
+	j.du = (int64_t)(r * app->cam.plane.x * 2.0 / app->view.w * side);
+	j.dv = (int64_t)(r * app->cam.plane.y * 2.0 / app->view.w * side);
+	app->kernels.flat_span(j);
+}
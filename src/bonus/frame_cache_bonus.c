@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_cache_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:31:50 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:34 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Checks whether two cameras see the world from the same place.            */
+/*                                                                            */
+/*   - Compares position, direction and camera plane exactly. An idle         */
+/*     player keeps these bit-identical (a zero rotation leaves the vectors   */
+/*     untouched), so no epsilon is needed.                                   */
+/*   - `view_z` is checked separately: it only shifts the columns vertically. */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	same_view(const t_camera *a, const t_camera *b)
+{
+	return (a->pos.x == b->pos.x && a->pos.y == b->pos.y
+		&& a->dir.x == b->dir.x && a->dir.y == b->dir.y
+		&& a->plane.x == b->plane.x && a->plane.y == b->plane.y);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Decides how much of the world layer must be redone this frame.           */
+/*                                                                            */
+/*   - CACHE_MISS   : no cached frame yet (or the render view was resized),   */
+/*                    or camera position/direction/plane changed. Every       */
+/*                    column is retraced.                                     */
+/*   - CACHE_VIEW_Z : only the vertical offset changed (jump, crouch, look    */
+/*                    up/down). Background is redrawn and cached columns are  */
+/*                    drawn again without running the DDA.                    */
+/*   - CACHE_DOORS  : camera unchanged but a door moved. Only the columns     */
+/*                    whose ray touched a door cell are repainted.            */
+/*   - CACHE_HIT    : nothing changed, the world layer is reused as is.       */
+/*                                                                            */
+/*   The current camera becomes the key of the cached frame.                  */
+/*                                                                            */
+/* ************************************************************************** */
+static t_cache_mode	frame_cache_mode(t_app *app)
+{
+	t_frame_cache	*c;
+	t_cache_mode	mode;
+
+	c = &app->cache;
+	if (!c->valid || !same_view(&c->cam, &app->cam))
+		mode = CACHE_MISS;
+	else if (c->cam.view_z != app->cam.view_z)
+		mode = CACHE_VIEW_Z;
+	else if (c->doors_dirty)
+		mode = CACHE_DOORS;
+	else
+		mode = CACHE_HIT;
+	c->cam = app->cam;
+	c->valid = true;
+	return (mode);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Updates the wall columns for the given cache mode.                       */
+/*                                                                            */
+/*   - For each column:                                                       */
+/*       • Retraces it on a cache miss, or when a door changed and the        */
+/*         column's ray crossed a door cell. In CACHE_DOORS mode its          */
+/*         background is repainted first, since the wall height may shrink.   */
+/*       • Otherwise, in CACHE_VIEW_Z mode, redraws it from the cache.        */
+/*                                                                            */
+/* ************************************************************************** */
+static void	update_columns(t_app *app, t_cache_mode mode)
+{
+	int	x;
+
+	x = -1;
+	while (++x < app->view.w)
+	{
+		if (mode == CACHE_MISS
+			|| (app->cache.doors_dirty && app->cache.cols[x].door))
+		{
+			if (mode == CACHE_DOORS)
+				ft_draw_background(app, x, x + 1);
+			trace_wall_column(app, x);
+		}
+		else if (mode == CACHE_VIEW_Z)
+			draw_wall_column(app, x);
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Updates the off-screen world layer (background + walls).                 */
+/*                                                                            */
+/*   - Scales view_z to the render view height (`view.z`).                    */
+/*   - Redraws the whole background unless only doors changed.                */
+/*   - Updates the wall columns (`update_columns`). With `cfg.interleave`, a  */
+/*     cache miss that follows a valid frame only traces half the columns     */
+/*     and rebuilds the rest from the previous frame (`render_interleaved`).  */
+/*   - Door changes are consumed once the columns are up to date.             */
+/*   - Returns the cache mode so the caller knows how much work was done.     */
+/*                                                                            */
+/* ************************************************************************** */
+t_cache_mode	render_world(t_app *app)
+{
+	t_cache_mode	mode;
+	t_camera		prev;
+	bool			reuse;
+
+	app->view.z = app->cam.view_z * ((double)app->view.h / app->cfg.height);
+	update_ray_table(app);
+	prev = app->cache.cam;
+	reuse = app->cfg.interleave && app->cache.valid;
+	mode = frame_cache_mode(app);
+	if (mode == CACHE_HIT)
+		return (mode);
+	if (mode != CACHE_DOORS)
+		ft_draw_background(app, 0, app->view.w);
+	if (mode == CACHE_MISS && reuse)
+		render_interleaved(app, &prev);
+	else
+		update_columns(app, mode);
+	app->cache.doors_dirty = false;
+	return (mode);
+}
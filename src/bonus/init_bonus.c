@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/20 12:48:06 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:29:45 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:24:10 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,39 +23,50 @@ int	init_app_struct(t_app *app, char **lines, int line_count)
 	ft_memset(app, 0, sizeof(*app));
 	ft_memset(app->game.floor_color, -1, sizeof(app->game.floor_color));
 	ft_memset(app->game.c_color, -1, sizeof(app->game.c_color));
+	app->game.arena.block_size = LEVEL_ARENA_BLOCK;
+	app->view.bilinear = VIEW_BILINEAR;
 	process_lines(lines, line_count, &app->game, &app->cam);
+	init_shade_table(&app->shade, &app->game);
 	return (0);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
 /*   Prepares a ray for grid DDA:                                             */
-/*   - camx = 2*x/WIDTH - 1: normalized device x in [-1,1].                   */
-/*   - raydir = cam.dir + cam.plane * camx: compute ray direction.            */
+/*   - raydir = dir, usually rays.dir[x] built once per frame by              */
+/*     update_ray_table.                                                      */
 /*   - map_x,map_y = integer cell of camera position.                         */
-/*   - raydir_mod = length of raydir vector.                                  */
-/*   - deltadist.x/y = abs(raydir_mod / raydir.x/y) for DDA stepping.         */
+/*   - deltadist.x/y = abs(1 / raydir.x/y) for DDA stepping. Distances stay   */
+/*     in units of |raydir|, so the DDA ends on the perpendicular distance    */
+/*     without normalizing the ray.                                           */
+/*   - door = false until the DDA enters a door cell.                         */
+/*   - No partial-height cells are collected (`slab`) unless the caller sets  */
+/*     a buffer; the open span (`clip`) starts unbounded. Likewise thin       */
+/*     walls stop the ray unless a `thin` buffer is set.                      */
 /*                                                                            */
 /* ************************************************************************** */
-void	init_ray(t_app *app, int x, t_ray *ray)
+void	init_ray(t_app *app, t_vec2 dir, t_ray *ray)
 {
-	double	camx;
-
-	camx = 2 * x / (double)WIDTH - 1;
-	ray->raydir.x = app->cam.dir.x + app->cam.plane.x * camx;
-	ray->raydir.y = app->cam.dir.y + app->cam.plane.y * camx;
+	ray->raydir = dir;
 	ray->map_x = (int)app->cam.pos.x;
 	ray->map_y = (int)app->cam.pos.y;
-	ray->raydir_mod = sqrt(pow(ray->raydir.x, 2) + pow(ray->raydir.y, 2));
-	ray->deltadist.x = fabs(ray->raydir_mod / ray->raydir.x);
-	ray->deltadist.y = fabs(ray->raydir_mod / ray->raydir.y);
+	ray->deltadist.x = fabs(1.0 / ray->raydir.x);
+	ray->deltadist.y = fabs(1.0 / ray->raydir.y);
+	ray->door = false;
+	ray->slab = NULL;
+	ray->slabs = 0;
+	ray->clip[0] = -HUGE_VAL;
+	ray->clip[1] = HUGE_VAL;
+	ray->thin = NULL;
+	ray->thins = 0;
 }
 
 /* ************************************************************************** */
 /*                                                                            */
 /*   Sets up collision bounds for a circle at (new_x,new_y):                  */
 /*   - r = COLLISION_RADIUS for player circle.                                */
-/*   - min_i/max_i, min_j/max_j = floor/ceil of pos ± r to cover tiles.       */
+/*   - min_i/max_i, min_j/max_j = floor of pos ± r: the cells the circle's    */
+/*     bounding box touches (at most 2 x 2 while r < 0.5).                    */
 /*   - These define the grid cells to check for collisions.                   */
 /*                                                                            */
 /* ************************************************************************** */
@@ -66,55 +77,7 @@ void	init_collision(t_collision *c, double new_x, double new_y)
 	r = COLLISION_RADIUS;
 	c->r = r;
 	c->min_i = (int)floor(new_y - r);
-	c->max_i = (int)ceil(new_y + r);
+	c->max_i = (int)floor(new_y + r);
 	c->min_j = (int)floor(new_x - r);
-	c->max_j = (int)ceil(new_x + r);
-}
-
-/* ************************************************************************** */
-/*                                                                            */
-/*   Adds a new enemy at map cell (i,j):                                      */
-/*   - Increments enemy_count and reallocates the enemies array.              */
-/*   - Sets pos to cell center (j+0.5,i+0.5), speed, active flag, radius,     */
-/*     and resets animation timers.                                           */
-/*   - Replaces map cell with '0' to clear spawn marker.                      */
-/*                                                                            */
-/* ************************************************************************** */
-void	init_enemy(t_game *g, int i, int j)
-{
-	g->enemy_count++;
-	g->enemies = realloc(g->enemies, sizeof(t_enemy) * g->enemy_count);
-	g->enemies[g->enemy_count - 1] = (t_enemy){
-		.pos_x = j + 0.5,
-		.pos_y = i + 0.5,
-		.speed = 0.6,
-		.is_active = 1,
-		.anim_frame = 0.0,
-		.time_since_last_move = 0.0,
-		.radius = 0.7
-	};
-	g->map[i][j] = '0';
-}
-
-/* ************************************************************************** */
-/*                                                                            */
-/*   Adds a new door at map cell (i,j):                                       */
-/*   - Increments door_count and reallocates the doors array.                 */
-/*   - Initializes x, y, orientation, is_open=false, open_offset, and timer.  */
-/*   - Sets map cell char to c to mark door in the map.                       */
-/*                                                                            */
-/* ************************************************************************** */
-void	init_door(t_game *g, int i, int j, char c)
-{
-	g->door_count++;
-	g->doors = realloc(g->doors, sizeof(t_door) * g->door_count);
-	g->doors[g->door_count - 1] = (t_door){
-		.x = j,
-		.y = i,
-		.is_open = 0,
-		.orientation = c,
-		.open_offset = 0.0,
-		.move_progress = DOOR_ANIM_DURATION
-	};
-	g->map[i][j] = c;
+	c->max_j = (int)floor(new_x + r);
 }
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interleave_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:44:51 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Projects a point, relative to the camera, onto the render view.          */
+/*                                                                            */
+/*   - `to_camera_space` gives (tx, ty), the same transform as sprites.       */
+/*   - `ty` is the perpendicular depth, the column is (w / 2) * (1 + tx/ty),  */
+/*     the inverse of rays.cam_x[x] = 2 * x / w - 1.                          */
+/*   - Returns -1 for points behind (or too close to) the camera.             */
+/*                                                                            */
+/* ************************************************************************** */
+static int	project_column(const t_app *app, t_vec2 rel, double *depth)
+{
+	t_vec2	t;
+
+	t = to_camera_space(app, rel);
+	*depth = t.y;
+	if (*depth < 0.05)
+		return (-1);
+	return ((int)floor(app->view.w / 2.0 * (1.0 + t.x / t.y) + 0.5));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Moves the cached column X of the previous frame to the current view.     */
+/*                                                                            */
+/*   - World hit = prev.pos + prev_raydir(x) * dist (as traced by the DDA).   */
+/*   - The hit keeps its texture column, only its depth (and so its line      */
+/*     height) and screen column change.                                      */
+/*   - When several columns land on the same target, the nearest one wins.    */
+/*   - Columns that touched a door are skipped: doors may be moving. So are   */
+/*     columns with partial-height cells or see-through walls, whose layers   */
+/*     would not line up.                                                     */
+/*                                                                            */
+/* ************************************************************************** */
+static void	reproject_column(t_app *app, const t_camera *prev, int x)
+{
+	t_column	*src;
+	t_column	*dst;
+	t_vec2		rel;
+	double		camx;
+	int			nx;
+
+	src = &app->cache.cols[x];
+	if (src->door || src->slabs || src->thins || !src->draw.tex)
+		return ;
+	camx = app->rays.cam_x[x];
+	rel.x = prev->pos.x + (prev->dir.x + prev->plane.x * camx) * src->dist
+		- app->cam.pos.x;
+	rel.y = prev->pos.y + (prev->dir.y + prev->plane.y * camx) * src->dist
+		- app->cam.pos.y;
+	nx = project_column(app, rel, &camx);
+	if (nx < 0 || nx >= app->view.w)
+		return ;
+	dst = &app->cache.reproj[nx];
+	if (dst->dist > 0.0 && dst->dist <= camx)
+		return ;
+	*dst = *src;
+	dst->dist = camx;
+	dst->draw.lh = (int)(app->view.h / camx);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Fills column X, which is not traced this frame.                          */
+/*                                                                            */
+/*   - Both neighbours were traced this frame. The reprojected depth must     */
+/*     lie between theirs, widened by INTERLEAVE_DEPTH_TOL, to be reused.     */
+/*   - Anything else (disocclusion, hole, depth jump, or a neighbour seeing   */
+/*     partial-height cells or see-through walls the reprojected column may   */
+/*     miss) is traced after all.                                             */
+/*                                                                            */
+/* ************************************************************************** */
+static void	fill_column(t_app *app, int x)
+{
+	t_column	*r;
+	double		d[2];
+	int			n[2];
+
+	r = &app->cache.reproj[x];
+	n[0] = x - 1;
+	if (n[0] < 0)
+		n[0] = x + 1;
+	n[1] = x + 1;
+	if (n[1] >= app->view.w)
+		n[1] = x - 1;
+	d[0] = fmin(app->cache.cols[n[0]].dist, app->cache.cols[n[1]].dist);
+	d[1] = fmax(app->cache.cols[n[0]].dist, app->cache.cols[n[1]].dist);
+	if (r->dist <= 0.0 || r->dist < d[0] * (1.0 - INTERLEAVE_DEPTH_TOL)
+		|| r->dist > d[1] * (1.0 + INTERLEAVE_DEPTH_TOL)
+		|| app->cache.cols[n[0]].slabs || app->cache.cols[n[1]].slabs
+		|| app->cache.cols[n[0]].thins || app->cache.cols[n[1]].thins)
+	{
+		trace_wall_column(app, x);
+		return ;
+	}
+	app->cache.cols[x] = *r;
+	draw_wall_column(app, x);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Interleaved wall pass for a moving camera (cfg.interleave).              */
+/*                                                                            */
+/*   - Every cached column of the previous frame is reprojected with the      */
+/*     camera delta into `cache.reproj`, before anything is overwritten.      */
+/*   - Only the columns of the current parity (even/odd, alternating every    */
+/*     frame) are traced, so each column is traced at least every other       */
+/*     frame and reconstruction errors cannot build up.                       */
+/*   - The column left of each traced one is filled right after it            */
+/*     (`fill_column`), once both its neighbours are known. The view is       */
+/*     swept left to right in one pass, which keeps the column writes to      */
+/*     `scene` cache friendly.                                                */
+/*                                                                            */
+/* ************************************************************************** */
+void	render_interleaved(t_app *app, const t_camera *prev)
+{
+	int	x;
+
+	ft_memset(app->cache.reproj, 0, app->view.w * sizeof(t_column));
+	x = -1;
+	while (++x < app->view.w)
+		reproject_column(app, prev, x);
+	app->cache.parity ^= 1;
+	x = app->cache.parity;
+	while (x < app->view.w)
+	{
+		trace_wall_column(app, x);
+		if (x > 0)
+			fill_column(app, x - 1);
+		x += 2;
+	}
+	if (x == app->view.w)
+		fill_column(app, x - 1);
+}
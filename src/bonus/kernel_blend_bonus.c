@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_blend_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:54:40 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Blends two rows, the vertical pass of the bilinear upscale:              */
+/*       dst[x] = lerp(r0[x], r1[x], f)                                       */
+/*                                                                            */
+/*   - Same packed two-lanes-per-word math as `lerp_pixel`, written inline    */
+/*     so every variant below vectorizes it. Reads are contiguous.            */
+/*                                                                            */
+/* ************************************************************************** */
+static inline __attribute__((always_inline)) void	blend_rows(t_row_job j)
+{
+	int			x;
+	uint32_t	a;
+	uint32_t	b;
+
+	x = -1;
+	while (++x < j.w)
+	{
+		a = j.r0[x];
+		b = j.r1[x];
+		j.dst[x] = ((((a & 0x00FF00FF) * (256 - j.f)
+						+ (b & 0x00FF00FF) * j.f) >> 8) & 0x00FF00FF)
+			| ((((a >> 8) & 0x00FF00FF) * (256 - j.f)
+					+ ((b >> 8) & 0x00FF00FF) * j.f) & 0xFF00FF00);
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Baseline variant, compiled for the target of the build.                  */
+/*                                                                            */
+/* ************************************************************************** */
+void	blend_rows_base(t_row_job j)
+{
+	blend_rows(j);
+}
+
+#if SIMD_X86
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   SSE4.2 variant.                                                          */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("sse4.2")))
+void	blend_rows_sse42(t_row_job j)
+{
+	blend_rows(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX2 variant.                                                            */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx2")))
+void	blend_rows_avx2(t_row_job j)
+{
+	blend_rows(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX-512 (F + BW) variant.                                                */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx512f,avx512bw")))
+void	blend_rows_avx512(t_row_job j)
+{
+	blend_rows(j);
+}
+
+#endif
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_flat_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:30:22 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws one textured floor or ceiling scanline with an affine step:        */
+/*       dst[x] = shade(tex[(v >> 16) & m][(u >> 16) & m]), u += du, v += dv  */
+/*                                                                            */
+/*   - Along a scanline the world point moves by a constant step, so the      */
+/*     texture coordinates cost two adds per pixel.                           */
+/*   - The shade row of each pixel is applied as an 8.8 factor with the       */
+/*     two-lanes-per-word math of `lerp_pixel` instead of three table loads,  */
+/*     so the loop vectorizes (texel loads become gathers on AVX2 and         */
+/*     AVX-512). It can differ from the table by one step per channel.        */
+/*                                                                            */
+/* ************************************************************************** */
+static inline __attribute__((always_inline)) void	flat_span(t_span_job j)
+{
+	int			x;
+	uint32_t	m;
+	uint32_t	px;
+	uint32_t	f;
+
+	m = (1u << j.bits) - 1;
+	x = -1;
+	while (++x < j.w)
+	{
+		px = j.tex[(((j.v >> 16) & m) << j.bits) | ((j.u >> 16) & m)];
+		f = j.mul[j.shade[x]];
+		j.dst[x] = ((((px & 0x00FF00FF) * f) >> 8) & 0x00FF00FF)
+			| ((((px >> 8) & 0x00FF00FF) * f) & 0x0000FF00) | 0xFF000000;
+		j.u += j.du;
+		j.v += j.dv;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Baseline variant, compiled for the target of the build.                  */
+/*                                                                            */
+/* ************************************************************************** */
+void	flat_span_base(t_span_job j)
+{
+	flat_span(j);
+}
+
+#if SIMD_X86
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   SSE4.2 variant.                                                          */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("sse4.2")))
+void	flat_span_sse42(t_span_job j)
+{
+	flat_span(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX2 variant.                                                            */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx2")))
+void	flat_span_avx2(t_span_job j)
+{
+	flat_span(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX-512 (F + BW) variant.                                                */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx512f,avx512bw")))
+void	flat_span_avx512(t_span_job j)
+{
+	flat_span(j);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_nearest_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:54:40 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Nearest-neighbour resampling of one row:                                 */
+/*       dst[x] = r0[(fx[x] + 128) >> 8]                                      */
+/*                                                                            */
+/*   - The body is written once and inlined into each variant below, which    */
+/*     the compiler vectorizes for its instruction set (indexed loads become  */
+/*     gathers on AVX2 and AVX-512). `init_kernels` picks the variant.        */
+/*                                                                            */
+/* ************************************************************************** */
+static inline __attribute__((always_inline)) void	nearest_row(t_row_job j)
+{
+	int	x;
+
+	x = -1;
+	while (++x < j.w)
+		j.dst[x] = j.r0[(j.fx[x] + 128) >> 8];
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Baseline variant, compiled for the target of the build.                  */
+/*                                                                            */
+/* ************************************************************************** */
+void	nearest_row_base(t_row_job j)
+{
+	nearest_row(j);
+}
+
+#if SIMD_X86
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   SSE4.2 variant.                                                          */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("sse4.2")))
+void	nearest_row_sse42(t_row_job j)
+{
+	nearest_row(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX2 variant.                                                            */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx2")))
+void	nearest_row_avx2(t_row_job j)
+{
+	nearest_row(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX-512 (F + BW) variant.                                                */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx512f,avx512bw")))
+void	nearest_row_avx512(t_row_job j)
+{
+	nearest_row(j);
+}
+
+#endif
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_stretch_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:54:40 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Stretches one row with linear filtering, the horizontal pass of the      */
+/*   bilinear upscale:                                                        */
+/*       i = fx[x] >> 8, f = fx[x] & 0xFF                                     */
+/*       dst[x] = lerp(r0[i], r0[min(i + 1, last)], f)                        */
+/*                                                                            */
+/*   - Same packed math as `lerp_pixel`, written inline so every variant      */
+/*     below vectorizes it (the two reads become gathers).                    */
+/*                                                                            */
+/* ************************************************************************** */
+static inline __attribute__((always_inline)) void	stretch_row(t_row_job j)
+{
+	int			x;
+	int			i;
+	uint32_t	f;
+	uint32_t	a;
+	uint32_t	b;
+
+	x = -1;
+	while (++x < j.w)
+	{
+		i = j.fx[x] >> 8;
+		f = j.fx[x] & 0xFF;
+		a = j.r0[i];
+		b = j.r0[i + (i < j.last)];
+		j.dst[x] = ((((a & 0x00FF00FF) * (256 - f)
+						+ (b & 0x00FF00FF) * f) >> 8) & 0x00FF00FF)
+			| ((((a >> 8) & 0x00FF00FF) * (256 - f)
+					+ ((b >> 8) & 0x00FF00FF) * f) & 0xFF00FF00);
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Baseline variant, compiled for the target of the build.                  */
+/*                                                                            */
+/* ************************************************************************** */
+void	stretch_row_base(t_row_job j)
+{
+	stretch_row(j);
+}
+
+#if SIMD_X86
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   SSE4.2 variant.                                                          */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("sse4.2")))
+void	stretch_row_sse42(t_row_job j)
+{
+	stretch_row(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX2 variant.                                                            */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx2")))
+void	stretch_row_avx2(t_row_job j)
+{
+	stretch_row(j);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   AVX-512 (F + BW) variant.                                                */
+/*                                                                            */
+/* ************************************************************************** */
+__attribute__((target("avx512f,avx512bw")))
+void	stretch_row_avx512(t_row_job j)
+{
+	stretch_row(j);
+}
+
+#endif
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   layers_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:12:58 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:16:34 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Creates the window layers and stacks them in depth order.                */
+/*                                                                            */
+/*   - The world layer is the main image (`app->image`).                      */
+/*   - The minimap gets a small square image placed at the minimap corner,    */
+/*     so it is drawn in layer-local coordinates around (r, r).               */
+/*   - Weapon and effects cover the window. Pixels nobody drew stay fully     */
+/*     transparent, and the effects layer starts hidden.                      */
+/*   - No layer needs to start dirty: on the first frame every layer's inputs */
+/*     differ from the zeroed state, so `update_layers` marks them all.       */
+/*                                                                            */
+/* ************************************************************************** */
+int	init_layers(t_app *app)
+{
+	t_layers	*l;
+	int			d;
+	int			i;
+
+	l = &app->layers;
+	d = 2 * app->cfg.mini_radius + 1;
+	l->img[LAYER_WORLD] = app->image;
+	l->img[LAYER_MINIMAP] = mlx_new_image(app->mlx, d, d);
+	l->img[LAYER_WEAPON] = mlx_new_image(app->mlx, app->cfg.width,
+			app->cfg.height);
+	l->img[LAYER_EFFECTS] = mlx_new_image(app->mlx, app->cfg.width,
+			app->cfg.height);
+	i = -1;
+	while (++i < LAYER_COUNT)
+	{
+		if (!l->img[i] || mlx_image_to_window(app->mlx, l->img[i], 0, 0) == -1)
+			return (mlx_terminate(app->mlx),
+				printf("Error: %s\n", mlx_strerror(mlx_errno)), -1);
+		mlx_set_instance_depth(&l->img[i]->instances[0], i);
+	}
+	l->img[LAYER_MINIMAP]->instances[0].x = app->cfg.mini_x - (d / 2);
+	l->img[LAYER_MINIMAP]->instances[0].y = app->cfg.mini_y - (d / 2);
+	l->img[LAYER_EFFECTS]->enabled = false;
+	l->weapon_frame = -1;
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns a signature of the enemies the minimap can show.                 */
+/*                                                                            */
+/*   - Hashes (FNV-1a) the index and exact position of every active enemy     */
+/*     within the minimap's reach, so any visible move changes it while       */
+/*     enemies wandering far away leave the minimap untouched.                */
+/*                                                                            */
+/* ************************************************************************** */
+static uint64_t	minimap_enemies(const t_app *app)
+{
+	uint64_t	h;
+	uint64_t	bits[2];
+	double		reach;
+	int			i;
+
+	h = 1469598103934665603ULL;
+	reach = app->cfg.mini_view_dist + 1.0;
+	i = -1;
+	while (++i < app->game.enemy_count)
+	{
+		if (!app->game.enemies[i].is_active
+			|| fabs(app->game.enemies[i].pos_x - app->cam.pos.x) > reach
+			|| fabs(app->game.enemies[i].pos_y - app->cam.pos.y) > reach)
+			continue ;
+		ft_memcpy(&bits[0], &app->game.enemies[i].pos_x, sizeof(double));
+		ft_memcpy(&bits[1], &app->game.enemies[i].pos_y, sizeof(double));
+		h = (h ^ (uint64_t)i) * 1099511628211ULL;
+		h = (h ^ bits[0]) * 1099511628211ULL;
+		h = (h ^ bits[1]) * 1099511628211ULL;
+	}
+	return (h);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns true if the player moved or turned since the minimap was drawn.  */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	minimap_moved(const t_app *app)
+{
+	const t_camera	*c;
+
+	c = &app->layers.mini_cam;
+	return (app->cam.pos.x != c->pos.x || app->cam.pos.y != c->pos.y
+		|| app->cam.dir.x != c->dir.x || app->cam.dir.y != c->dir.y);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Marks the layers whose inputs changed since they were last drawn.        */
+/*                                                                            */
+/*   - World: the render cache redrew something, or the signature of the      */
+/*     enemy sprites on screen (`sprites`, see `visible_sprites`) changed:    */
+/*     one moved, animated, flashed, came into view or left it.               */
+/*   - Minimap: the player moved or turned, a door moved (`doors`, sampled    */
+/*     before `render_world` consumed it) or a nearby enemy moved.            */
+/*   - Weapon: the animation frame changed.                                   */
+/*   - Effects: the hit overlay opacity changed.                              */
+/*                                                                            */
+/* ************************************************************************** */
+void	update_layers(t_app *app, t_cache_mode mode, bool doors,
+			uint64_t sprites)
+{
+	t_layers	*l;
+	uint64_t	sig;
+
+	l = &app->layers;
+	if (mode != CACHE_HIT || sprites != l->sprites)
+		l->dirty[LAYER_WORLD] = true;
+	l->sprites = sprites;
+	sig = minimap_enemies(app);
+	if (doors || sig != l->mini_enemies || minimap_moved(app))
+		l->dirty[LAYER_MINIMAP] = true;
+	l->mini_enemies = sig;
+	l->mini_cam = app->cam;
+	if (app->weapon.current_frame != l->weapon_frame)
+		l->dirty[LAYER_WEAPON] = true;
+	if (hit_feedback_alpha(app) != l->effect_alpha)
+		l->dirty[LAYER_EFFECTS] = true;
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   level_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:35:40 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:14:36 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Sizes the doors and enemies arrays before the map rows are processed.    */
+/*                                                                            */
+/*   - Counts the door ('2', '3') and enemy ('B') cells of the map.           */
+/*   - Allocates both arrays once from the level arena, so `init_door` and    */
+/*     `init_enemy` only append. They are released with the arena.            */
+/*   - The door scheduler's active set and event queue hold at most one       */
+/*     entry per door; both share a single allocation.                        */
+/*   - Exits with an error if memory runs out.                                */
+/*                                                                            */
+/* ************************************************************************** */
+void	reserve_entities(t_game *g)
+{
+	int	doors;
+	int	enemies;
+	int	i;
+	int	j;
+
+	doors = 0;
+	enemies = 0;
+	i = -1;
+	while (++i < g->map_height)
+	{
+		j = -1;
+		while (g->map[i][++j])
+		{
+			doors += (g->map[i][j] == '2' || g->map[i][j] == '3');
+			enemies += (g->map[i][j] == 'B');
+		}
+	}
+	g->doors = arena_alloc(&g->arena, (doors + 1) * sizeof(t_door));
+	g->enemies = arena_alloc(&g->arena, (enemies + 1) * sizeof(t_enemy));
+	g->door_sched.active = arena_alloc(&g->arena,
+			2 * (doors + 1) * sizeof(int));
+	g->door_sched.events = g->door_sched.active + doors + 1;
+	if (!g->doors || !g->enemies || !g->door_sched.active)
+		exit(write(2, "Error\nOut of memory\n", 20));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Adds a new enemy at map cell (i,j):                                      */
+/*   - Appends it to the enemies array sized by `reserve_entities`.           */
+/*   - Sets pos to cell center (j+0.5,i+0.5), speed, active flag, radius,     */
+/*     and resets animation timers.                                           */
+/*   - Replaces map cell with '0' to clear spawn marker.                      */
+/*                                                                            */
+/* ************************************************************************** */
+void	init_enemy(t_game *g, int i, int j)
+{
+	g->enemies[g->enemy_count++] = (t_enemy){
+		.pos_x = j + 0.5,
+		.pos_y = i + 0.5,
+		.speed = 0.6,
+		.is_active = 1,
+		.anim_frame = 0.0,
+		.time_since_last_move = 0.0,
+		.radius = 0.7
+	};
+	g->map[i][j] = '0';
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Adds a new door at map cell (i,j):                                       */
+/*   - Appends it to the doors array sized by `reserve_entities`.             */
+/*   - Initializes x, y, orientation, is_open=false, open_offset, and timer;  */
+/*     it stays out of the scheduler until it is opened.                      */
+/*   - Sets map cell char to c to mark door in the map.                       */
+/*                                                                            */
+/* ************************************************************************** */
+void	init_door(t_game *g, int i, int j, char c)
+{
+	g->doors[g->door_count++] = (t_door){
+		.x = j,
+		.y = i,
+		.is_open = 0,
+		.orientation = c,
+		.open_offset = 0.0,
+		.move_progress = DOOR_ANIM_DURATION
+	};
+	g->map[i][j] = c;
+}
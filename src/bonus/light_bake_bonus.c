@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_bake_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:07:18 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:40:53 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Fills `light.source` with the light sources of the level.                */
+/*                                                                            */
+/*   - Lamps: 'L' map cells emit LIGHT_LAMP and become floor ('0').           */
+/*   - Ceiling panels: the random 15x15 panel pattern is drawn here, once     */
+/*     per run, so the lit panels the ceiling pass draws (see t_bg_tables)    */
+/*     are the ones baked as LIGHT_PANEL sources. A textured ceiling (CT)     */
+/*     has no panels.                                                         */
+/*                                                                            */
+/* ************************************************************************** */
+static void	mark_sources(t_app *app)
+{
+	t_light_map	*m;
+	char		*row;
+	int			x;
+	int			y;
+
+	m = &app->game.light;
+	srand((unsigned int)(mlx_get_time() * 100.0));
+	x = -1;
+	while (++x < 225)
+		app->bg.light_panel[x] = (rand() % 15) == 0 && !app->game.texture_ceil;
+	y = -1;
+	while (++y < m->h)
+	{
+		row = app->game.map[y];
+		x = -1;
+		while (row[++x])
+		{
+			if (row[x] == 'L')
+				m->source[y * m->w + x] = LIGHT_LAMP;
+			else if (row[x] == '0' && app->bg.light_panel[x % 15 * 15 + y % 15])
+				m->source[y * m->w + x] = LIGHT_PANEL;
+			if (row[x] == 'L')
+				row[x] = '0';
+		}
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Bakes the light map of the level at load time.                           */
+/*                                                                            */
+/*   - The map is w x h cells, w being its longest row. Sources, cell and     */
+/*     corner light come from the level arena.                                */
+/*   - The collision grid, the same size, is built before the first bake, so  */
+/*     the line of sight tests read doors and walls from it.                  */
+/*   - Every cell is lit once here; at run time only door changes rebake a    */
+/*     small area (`door_light_event`), so lighting costs nothing per         */
+/*     frame beyond the lookups of the render passes.                         */
+/*   - Returns -1 if memory runs out, 0 otherwise.                            */
+/*                                                                            */
+/* ************************************************************************** */
+int	bake_light_map(t_app *app)
+{
+	t_game		*g;
+	t_light_map	*m;
+	int			i;
+
+	g = &app->game;
+	m = &g->light;
+	m->h = g->map_height;
+	i = -1;
+	while (++i < g->map_height)
+		if ((int)ft_strlen(g->map[i]) > m->w)
+			m->w = ft_strlen(g->map[i]);
+	m->source = arena_alloc(&g->arena, m->w * m->h);
+	m->cell = arena_alloc(&g->arena, m->w * m->h);
+	m->corner = arena_alloc(&g->arena, (m->w + 1) * (m->h + 1));
+	if (!m->source || !m->cell || !m->corner)
+		return (printf("Error: Out of memory\n"), -1);
+	if (build_collision_grid(g) == -1)
+		return (-1);
+	mark_sources(app);
+	relight_area(g, 0, 0, m->w + m->h);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Light map subscriber (see `dispatch_door_events`): rebakes the light     */
+/*   around a door that opened or closed.                                     */
+/*                                                                            */
+/*   - Runs from `snapshot_state`, while the render thread is idle, as the    */
+/*     render context shares the light map.                                   */
+/*   - Flags the light map as changed; `snapshot_state` then drops the        */
+/*     cached world of the context, since its shading is stale.               */
+/*                                                                            */
+/* ************************************************************************** */
+void	door_light_event(t_app *app, const t_door *d)
+{
+	relight_area(&app->game, d->x, d->y, LIGHT_RADIUS);
+	app->cache.light_dirty = true;
+}
@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:06:22 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:40:53 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Tells whether light can pass through map cell (x, y).                    */
+/*                                                                            */
+/*   - Walls, void (' ') and cells outside the map block light.               */
+/*   - Door cells block it until the door is opened. Both tests are lookups   */
+/*     in the collision grid (`find_door`, `safe_get_tile`).                  */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	blocks_light(t_game *g, int x, int y)
+{
+	int		i;
+	char	c;
+
+	i = find_door(g, x, y);
+	if (i >= 0)
+		return (!g->doors[i].is_open);
+	c = safe_get_tile(g, x, y);
+	return (c == '1' || c == ' ' || c == '\0');
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Line of sight between the centers of cells `a` and `b`.                  */
+/*                                                                            */
+/*   - The segment is sampled every quarter cell; the cells in between must   */
+/*     all let light through. The two end cells are not tested.               */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	visible(t_game *g, const int *a, const int *b)
+{
+	double	len;
+	double	t;
+	int		x;
+	int		y;
+
+	len = sqrt((b[0] - a[0]) * (b[0] - a[0]) + (b[1] - a[1]) * (b[1] - a[1]));
+	t = 0.25;
+	while (t < len)
+	{
+		x = (int)(a[0] + 0.5 + (b[0] - a[0]) * t / len);
+		y = (int)(a[1] + 0.5 + (b[1] - a[1]) * t / len);
+		if (!((x == a[0] && y == a[1]) || (x == b[0] && y == b[1]))
+			&& blocks_light(g, x, y))
+			return (false);
+		t += 0.25;
+	}
+	return (true);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Light received by cell c = {x, y}: LIGHT_AMBIENT plus every source       */
+/*   within LIGHT_RADIUS cells that can see it.                               */
+/*                                                                            */
+/*   - A source of power p at distance d adds p * (1 - d / LIGHT_RADIUS)^2.   */
+/*   - The sum saturates at 255. Walls receive none; closed doors are lit     */
+/*     like the floor in front of them.                                       */
+/*                                                                            */
+/* ************************************************************************** */
+static uint8_t	gather(t_game *g, const int *c)
+{
+	t_light_map	*m;
+	int			s[2];
+	double		f;
+	double		sum;
+
+	m = &g->light;
+	if (ft_strchr("1 ", safe_get_tile(g, c[0], c[1])))
+		return (0);
+	sum = LIGHT_AMBIENT;
+	s[1] = c[1] - LIGHT_RADIUS - 1;
+	while (++s[1] <= c[1] + LIGHT_RADIUS)
+	{
+		s[0] = c[0] - LIGHT_RADIUS - 1;
+		while (++s[0] <= c[0] + LIGHT_RADIUS)
+		{
+			if (s[0] < 0 || s[1] < 0 || s[0] >= m->w || s[1] >= m->h
+				|| !m->source[s[1] * m->w + s[0]])
+				continue ;
+			f = 1.0 - sqrt((s[0] - c[0]) * (s[0] - c[0])
+					+ (s[1] - c[1]) * (s[1] - c[1])) / LIGHT_RADIUS;
+			if (f > 0.0 && visible(g, s, c))
+				sum += m->source[s[1] * m->w + s[0]] * f * f;
+		}
+	}
+	return ((uint8_t)fmin(sum, 255.0));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Light at corner (x, y): the average of the lit cells touching it, so     */
+/*   walls do not darken the edges of the floor next to them.                 */
+/*                                                                            */
+/* ************************************************************************** */
+static uint8_t	corner_light(const t_light_map *m, int x, int y)
+{
+	int	sum;
+	int	n;
+	int	i;
+	int	cx;
+	int	cy;
+
+	sum = 0;
+	n = 0;
+	i = -1;
+	while (++i < 4)
+	{
+		cx = x - 1 + i % 2;
+		cy = y - 1 + i / 2;
+		if (cx < 0 || cy < 0 || cx >= m->w || cy >= m->h
+			|| !m->cell[cy * m->w + cx])
+			continue ;
+		sum += m->cell[cy * m->w + cx];
+		n++;
+	}
+	if (!n)
+		return (0);
+	return (sum / n);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Rebakes the cells within `r` of (x, y), then the corners around them.    */
+/*                                                                            */
+/*   - Used for the full bake and, with r = LIGHT_RADIUS, when a door opens:  */
+/*     only cells within that distance can see a source through the door.     */
+/*                                                                            */
+/* ************************************************************************** */
+void	relight_area(t_game *g, int x, int y, int r)
+{
+	t_light_map	*m;
+	int			lo[2];
+	int			c[2];
+
+	m = &g->light;
+	lo[0] = x - r;
+	if (lo[0] < 0)
+		lo[0] = 0;
+	lo[1] = y - r;
+	if (lo[1] < 0)
+		lo[1] = 0;
+	c[1] = lo[1] - 1;
+	while (++c[1] < m->h && c[1] <= y + r)
+	{
+		c[0] = lo[0] - 1;
+		while (++c[0] < m->w && c[0] <= x + r)
+			m->cell[c[1] * m->w + c[0]] = gather(g, c);
+	}
+	c[1] = lo[1] - 1;
+	while (++c[1] <= m->h && c[1] <= y + r + 1)
+	{
+		c[0] = lo[0] - 1;
+		while (++c[0] <= m->w && c[0] <= x + r + 1)
+			m->corner[c[1] * (m->w + 1) + c[0]] = corner_light(m, c[0], c[1]);
+	}
+}
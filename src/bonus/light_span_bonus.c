@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_span_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:10:38 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 15:27:09 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Samples the light map at world position (x, y), 0-255.                   */
+/*                                                                            */
+/*   - Bilinear between the four corners of the cell, in 8-bit fixed point,   */
+/*     so light fades smoothly across cells instead of in blocks.             */
+/*   - Outside the map the ambient light is returned.                         */
+/*                                                                            */
+/* ************************************************************************** */
+int	light_at(const t_light_map *m, double x, double y)
+{
+	const uint8_t	*c;
+	int				i;
+	int				j;
+	int				fx;
+	int				fy;
+
+	if (x < 0.0 || y < 0.0 || x >= m->w || y >= m->h)
+		return (LIGHT_AMBIENT);
+	i = (int)x;
+	j = (int)y;
+	fx = (int)((x - i) * 256.0);
+	fy = (int)((y - j) * 256.0);
+	c = m->corner + j * (m->w + 1) + i;
+	return (((c[0] * (256 - fx) + c[1] * fx) * (256 - fy)
+			+ (c[m->w + 1] * (256 - fx) + c[m->w + 2] * fx) * fy) >> 16);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns the shade table row for a distance level lit by `light`.         */
+/*                                                                            */
+/*   - `light` comes from the light map (0-255, see light_at); 255 keeps the  */
+/*     distance level unchanged. Integer only, cheap enough per pixel.        */
+/*                                                                            */
+/* ************************************************************************** */
+int	shade_row(int level, int light)
+{
+	return ((level * light + 128) >> 8);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Light map sample of the floor/ceiling point seen by view column x at     */
+/*   distance factor r (world = pos + r * rays.dir[x]).                       */
+/*                                                                            */
+/* ************************************************************************** */
+static int	light_ahead(const t_app *app, double r, int x)
+{
+	return (light_at(&app->game.light, app->cam.pos.x + r * app->rays.dir[x].x,
+			app->cam.pos.y + r * app->rays.dir[x].y));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Shade row of every pixel of a floor/ceiling scanline, columns in         */
+/*   [span[0], span[1]), at distance factor r.                                */
+/*                                                                            */
+/*   - The world point moves linearly along a scanline and the light map is   */
+/*     smooth, so it is sampled every LIGHT_STEP pixels and interpolated in   */
+/*     8.8 fixed point in between (x[1] is the end of the segment, v holds    */
+/*     the light, its step and the light at the segment end).                 */
+/*   - out[x] = shade_row(distance level, light), as for walls and sprites.   */
+/*                                                                            */
+/* ************************************************************************** */
+void	shade_span(const t_app *app, double r, const int *span, uint8_t *out)
+{
+	int	level;
+	int	x[2];
+	int	v[3];
+
+	if (span[1] <= span[0])
+		return ;
+	level = shade_level(r);
+	x[0] = span[0];
+	v[2] = light_ahead(app, r, x[0]) << 8;
+	while (x[0] < span[1] - 1)
+	{
+		v[0] = v[2];
+		x[1] = x[0] + LIGHT_STEP;
+		if (x[1] > span[1] - 1)
+			x[1] = span[1] - 1;
+		v[2] = light_ahead(app, r, x[1]) << 8;
+		v[1] = (v[2] - v[0]) / (x[1] - x[0]);
+		while (x[0] < x[1])
+		{
+			out[x[0]++] = shade_row(level, v[0] >> 8);
+			v[0] += v[1];
+		}
+	}
+	out[x[0]] = shade_row(level, v[2] >> 8);
+}
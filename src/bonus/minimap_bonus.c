@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/18 11:36:39 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 12:45:15 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 14:17:40 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,24 +16,28 @@
 /*                                                                            */
 /*   Draws the player indicator on the minimap.                               */
 /*                                                                            */
-/*   - Puts a green pixel at the center (MINI_X, MINI_Y).                     */
+/*   - Puts a green pixel at the minimap center (r, r in layer coordinates).  */
 /*   - Draws a vertical white line below.                                     */
 /*   - Draws two diagonal white lines to the sides forming a "∧" shape.       */
 /*                                                                            */
 /* ************************************************************************** */
 static void	draw_player_indicator(t_app *app)
 {
-	int	i;
+	mlx_image_t	*img;
+	int			r;
+	int			i;
 
-	mlx_put_pixel(app->image, MINI_X, MINI_Y, 0x00FF00FF);
+	img = app->layers.img[LAYER_MINIMAP];
+	r = app->cfg.mini_radius;
+	mlx_put_pixel(img, r, r, 0x00FF00FF);
 	i = -1;
 	while (++i < 10)
-		mlx_put_pixel(app->image, MINI_X, MINI_Y + i, 0xFFFFFFFF);
+		mlx_put_pixel(img, r, r + i, 0xFFFFFFFF);
 	i = -1;
 	while (++i < 5)
 	{
-		mlx_put_pixel(app->image, MINI_X - i, MINI_Y - 3 + i, 0xFFFFFFFF);
-		mlx_put_pixel(app->image, MINI_X + i, MINI_Y - 3 + i, 0xFFFFFFFF);
+		mlx_put_pixel(img, r - i, r - 3 + i, 0xFFFFFFFF);
+		mlx_put_pixel(img, r + i, r - 3 + i, 0xFFFFFFFF);
 	}
 }
 
@@ -53,17 +57,19 @@ static void	draw_enemy(t_vec2 pos, t_app *app)
 	t_vec2	pixel;
 	t_vec2	center;
 
-	center = (t_vec2){MINI_X, MINI_Y};
+	center = (t_vec2){app->cfg.mini_radius, app->cfg.mini_radius};
 	dx = -3;
 	while (++dx < 4)
 	{
 		dy = -3;
 		while (++dy < 4)
 		{
-			pixel.x = MINI_X + (pos.x * MINI_SCALE) + dx;
-			pixel.y = MINI_Y + (pos.y * MINI_SCALE) + dy;
-			if (hypot(pixel.x - center.x, pixel.y - center.y) <= MINI_RADIUS)
-				mlx_put_pixel(app->image, pixel.x, pixel.y, 0xFF0000FF);
+			pixel.x = center.x + (pos.x * app->cfg.mini_scale) + dx;
+			pixel.y = center.y + (pos.y * app->cfg.mini_scale) + dy;
+			if (hypot(pixel.x - center.x, pixel.y - center.y)
+				<= app->cfg.mini_radius)
+				mlx_put_pixel(app->layers.img[LAYER_MINIMAP],
+					pixel.x, pixel.y, 0xFF0000FF);
 		}
 	}
 }
@@ -118,7 +124,9 @@ void	draw_enemies(t_app *app)
 /* ************************************************************************** */
 /*                                                                            */
 /*   Renders the entire minimap, including background, features, enemies,     */
-/*   and the player indicator.                                                */
+/*   and the player indicator, into the minimap layer.                        */
+/*   - The minimap has its own image: the disc is repainted here and only     */
+/*     when `update_layers` saw the player, a door or a nearby enemy move.    */
 /*                                                                            */
 /* ************************************************************************** */
 void	render_minimap(t_app *app)
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/18 18:06:16 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:29:43 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,22 +16,27 @@
 /*                                                                            */
 /*   Draws the circular background of the minimap.                            */
 /*                                                                            */
-/*   - Fills a circle centered at (MINI_X, MINI_Y) with a dark gray color.    */
+/*   - Fills a circle centered on the minimap layer in dark gray.             */
+/*   - This repaints every pixel drawn by the previous minimap, so the layer  */
+/*     needs no clearing; pixels outside the circle stay transparent.         */
 /*   - Only pixels inside the radius are colored.                             */
 /*                                                                            */
 /* ************************************************************************** */
 void	draw_minimap_background(t_app *app)
 {
-	int	i;
-	int	j;
+	t_config	*c;
+	int			i;
+	int			j;
 
-	i = -MINI_RADIUS - 1;
-	while (++i <= MINI_RADIUS)
+	c = &app->cfg;
+	i = -c->mini_radius - 1;
+	while (++i <= c->mini_radius)
 	{
-		j = -MINI_RADIUS - 1;
-		while (++j <= MINI_RADIUS)
-			if (i * i + j * j <= MINI_RADIUS * MINI_RADIUS)
-				mlx_put_pixel(app->image, MINI_X + j, MINI_Y + i, 0x202020FF);
+		j = -c->mini_radius - 1;
+		while (++j <= c->mini_radius)
+			if (i * i + j * j <= c->mini_radius * c->mini_radius)
+				mlx_put_pixel(app->layers.img[LAYER_MINIMAP],
+					c->mini_radius + j, c->mini_radius + i, 0x202020FF);
 	}
 }
 
@@ -39,7 +44,8 @@ void	draw_minimap_background(t_app *app)
 /*                                                                            */
 /*   Determines the color to use for a given tile at (x, y) on the map.       */
 /*                                                                            */
-/*   - Walls ('1') are gray.                                                  */
+/*   - Walls ('1') are gray, partial-height cells (BLOCK_TILES) and thin      */
+/*     walls (THIN_TILES) light gray.                                         */
 /*   - Doors ('2' or '3') are orange if closed and green if open.             */
 /*   - Other tiles are transparent (color 0).                                 */
 /*                                                                            */
@@ -52,6 +58,8 @@ static uint32_t	get_tile_color(t_app *app, int x, int y)
 	tile = safe_get_tile(&app->game, x, y);
 	if (tile == '1')
 		return (0x808080FF);
+	if (ft_strchr(BLOCK_TILES, tile) || ft_strchr(THIN_TILES, tile))
+		return (0xB8B8B8FF);
 	if (tile == '2' || tile == '3')
 	{
 		d = -1;
@@ -95,8 +103,10 @@ static void	draw_rotated_pixels(t_app *app, int cx, int cy, uint32_t color)
 		{
 			rot_x = dx * cos(angle) - dy * sin(angle);
 			rot_y = dx * sin(angle) + dy * cos(angle);
-			if (hypot(cx + rot_x - MINI_X, cy + rot_y - MINI_Y) <= MINI_RADIUS)
-				mlx_put_pixel(app->image, cx + rot_x, cy + rot_y, color);
+			if (hypot(cx + rot_x - app->cfg.mini_radius, cy + rot_y
+					- app->cfg.mini_radius) <= app->cfg.mini_radius)
+				mlx_put_pixel(app->layers.img[LAYER_MINIMAP],
+					cx + rot_x, cy + rot_y, color);
 		}
 	}
 }
@@ -112,24 +122,27 @@ static void	draw_rotated_pixels(t_app *app, int cx, int cy, uint32_t color)
 /* ************************************************************************** */
 void	draw_map_features(t_app *app)
 {
+	t_config	*c;
 	int			x;
 	int			y;
 	uint32_t	color;
-	double		angle;
+	t_vec2		rot;
 
-	angle = -atan2(app->cam.dir.y, app->cam.dir.x) - M_PI / 2.0;
-	x = -MINI_VIEW_DIST - 1;
-	while (++x <= MINI_VIEW_DIST)
+	c = &app->cfg;
+	rot.x = -atan2(app->cam.dir.y, app->cam.dir.x) - M_PI / 2.0;
+	rot = (t_vec2){cos(rot.x), sin(rot.x)};
+	x = -c->mini_view_dist - 1;
+	while (++x <= c->mini_view_dist)
 	{
-		y = -MINI_VIEW_DIST - 1;
-		while (++y <= MINI_VIEW_DIST)
+		y = -c->mini_view_dist - 1;
+		while (++y <= c->mini_view_dist)
 		{
 			color = get_tile_color(app, (int)app->cam.pos.x + x,
 					(int)app->cam.pos.y + y);
 			if (color)
 				draw_rotated_pixels(app,
-					MINI_X + (x * cos(angle) - y * sin(angle)) * MINI_SCALE,
-					MINI_Y + (x * sin(angle) + y * cos(angle)) * MINI_SCALE,
+					c->mini_radius + (x * rot.x - y * rot.y) * c->mini_scale,
+					c->mini_radius + (x * rot.y + y * rot.x) * c->mini_scale,
 					color);
 		}
 	}
@@ -6,7 +6,7 @@
 /*   By: aescande <aescande@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/16 22:25:21 by aescande          #+#    #+#             */
-/*   Updated: 2025/04/26 12:51:19 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 15:03:25 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -67,7 +67,8 @@ void	jump(t_app *app)
 		}
 		dt = mlx_get_time() - j.x;
 		v = j.y + 200 * dt;
-		if (!(fabs(app->cam.view_z) > HEIGHT && app->cam.view_z * v > 0))
+		if (!(fabs(app->cam.view_z) > app->cfg.height
+				&& app->cam.view_z * v > 0))
 		{
 			if (v >= 0)
 				app->cam.view_z -= j.y * dt + 100 * pow(dt, 2);
@@ -78,27 +79,3 @@ void	jump(t_app *app)
 			is_jumping = 0;
 	}
 }
-
-/* ************************************************************************** */
-/*                                                                            */
-/*   Applies fog effect based on distance.                                    */
-/*                                                                            */
-/*   - Darkens the given color according to the distance and fog density.     */
-/*   - Ensures the fog factor does not fall below a minimum threshold.        */
-/*                                                                            */
-/* ************************************************************************** */
-uint32_t	fog(const int *color, double r, double fog_dens, double min_factor)
-{
-	double	fog_factor;
-	int		dr;
-	int		dg;
-	int		db;
-
-	fog_factor = 1.0 / (1.0 + fog_dens * r);
-	if (fog_factor < min_factor)
-		fog_factor = min_factor;
-	dr = (int)(color[0] * fog_factor);
-	dg = (int)(color[1] * fog_factor);
-	db = (int)(color[2] * fog_factor);
-	return (ft_pixel(dr, dg, db, 255));
-}
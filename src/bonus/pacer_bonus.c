@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pacer_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:30:28 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:42:18 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Sets up frame pacing once the window exists.                             */
+/*                                                                            */
+/*   - PACE_VSYNC makes the buffer swap wait for the display (swap interval   */
+/*     1), so MLX blocks instead of spinning. Every other mode swaps          */
+/*     immediately: PACE_TARGET does its own waiting in `pace_frame`.         */
+/*                                                                            */
+/* ************************************************************************** */
+void	init_pacer(t_app *app)
+{
+	glfwSwapInterval(app->cfg.pace == PACE_VSYNC);
+	app->pacer.next = mlx_get_time();
+	app->pacer.report = app->pacer.next;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Idles until the next frame is due (PACE_TARGET only).                    */
+/*                                                                            */
+/*   - Called at the end of the frame hook, after the render thread got its   */
+/*     work, so the thread keeps rendering while the MLX thread sleeps.       */
+/*   - Deadlines advance by exactly one period, which keeps the average rate  */
+/*     on target even if a sleep overshoots. A frame more than one period     */
+/*     late restarts the schedule instead of rushing to catch up.             */
+/*                                                                            */
+/* ************************************************************************** */
+void	pace_frame(t_app *app)
+{
+	t_pacer	*p;
+	double	period;
+	double	now;
+
+	if (app->cfg.pace != PACE_TARGET)
+		return ;
+	p = &app->pacer;
+	period = 1.0 / app->cfg.fps;
+	now = mlx_get_time();
+	if (p->next > now)
+		usleep((useconds_t)((p->next - now) * 1e6));
+	else if (now - p->next > period)
+		p->next = now;
+	p->next += period;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Shows the frame rate and latency of the last period in the title, and    */
+/*   the allocations made during it when allocation tracking is linked in.    */
+/*                                                                            */
+/* ************************************************************************** */
+static void	report_pacing(t_app *app, double now)
+{
+	char			title[96];
+	t_alloc_stats	st;
+	int				n;
+
+	n = snprintf(title, sizeof(title), "cub3D - %.0f fps - %.1f ms latency",
+			app->pacer.frames / (now - app->pacer.report), app->pacer.latency);
+	ft_alloc_stats(&st);
+	if (st.enabled && n > 0 && n < (int)sizeof(title))
+		snprintf(title + n, sizeof(title) - n, " - %zu allocs",
+			st.allocs - app->pacer.allocs);
+	app->pacer.allocs = st.allocs;
+	mlx_set_window_title(app->mlx, title);
+	app->pacer.report = now;
+	app->pacer.frames = 0;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Records that a frame reached the window.                                 */
+/*                                                                            */
+/*   - `input_time` is when the simulation step behind this frame sampled     */
+/*     the keyboard (`update_camera_movement`). The sample covers the         */
+/*     render thread and the wait for it; MLX shows the frame right after     */
+/*     the hook returns.                                                      */
+/*   - latency is smoothed with an exponential moving average:                */
+/*       ema = ema + (sample - ema) * 0.1                                     */
+/*   - Every PACE_REPORT_S seconds the frame rate and latency go to the       */
+/*     window title.                                                          */
+/*   - Closes the frame for the allocation tracker (a no-op unless it is      */
+/*     linked in), which counts the frames that allocated.                    */
+/*                                                                            */
+/* ************************************************************************** */
+void	record_present(t_app *app, double input_time)
+{
+	t_pacer	*p;
+	double	now;
+	double	sample;
+
+	p = &app->pacer;
+	now = mlx_get_time();
+	sample = (now - input_time) * 1000.0;
+	if (p->latency == 0.0)
+		p->latency = sample;
+	p->latency += (sample - p->latency) * 0.1;
+	p->frames++;
+	ft_alloc_frame();
+	if (now - p->report >= PACE_REPORT_S)
+		report_pacing(app, now);
+}
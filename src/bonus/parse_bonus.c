@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:02:45 by victor            #+#    #+#             */
-/*   Updated: 2025/04/25 11:01:01 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -70,6 +70,12 @@ static int	check_texture_duplicate(t_game *game, const char *texture_type)
 		return (1);
 	if (!ft_strncmp(texture_type, "EA", 2) && game->texture_ea)
 		return (1);
+	if (!ft_strncmp(texture_type, "FT", 2) && game->texture_floor)
+		return (1);
+	if (!ft_strncmp(texture_type, "CT", 2) && game->texture_ceil)
+		return (1);
+	if (!ft_strncmp(texture_type, "GR", 2) && game->texture_thin)
+		return (1);
 	return (0);
 }
 
@@ -78,36 +84,39 @@ static int	check_texture_duplicate(t_game *game, const char *texture_type)
 /*   Processes a texture or color directive from the map file.                */
 /*                                                                            */
 /*   - Checks for duplicate texture definitions.                              */
-/*   - Assigns texture paths to their respective variables.                   */
-/*   - Calls `parse_color()` for floor (F) and ceiling (C) colors.            */
+/*   - Copies the trimmed texture paths into the level arena.                 */
+/*   - Calls `parse_color()` for floor (F) and ceiling (C) colors. The        */
+/*     optional floor (FT) and ceiling (CT) textures are matched first        */
+/*     (`parse_extra_texture()`, with the thin wall texture GR), since they   */
+/*     share the first letter of the colors.                                  */
 /*                                                                            */
 /* ************************************************************************** */
 static void	process_texture(char *trimmed, t_game *game)
 {
 	if (check_texture_duplicate(game, trimmed))
-	{
 		exit(write(2, "Error\nDuplicate texture\n", 24));
-	}
+	if (parse_extra_texture(trimmed, game))
+		return ;
 	if (!ft_strncmp(trimmed, "NO", 2))
-		game->texture_no = ft_strtrim(skip_spaces(trimmed + 2), " ");
+		game->texture_no = arena_strtrim(&game->arena, trimmed + 2, " ");
 	else if (!ft_strncmp(trimmed, "SO", 2))
-		game->texture_so = ft_strtrim(skip_spaces(trimmed + 2), " ");
+		game->texture_so = arena_strtrim(&game->arena, trimmed + 2, " ");
 	else if (!ft_strncmp(trimmed, "WE", 2))
-		game->texture_we = ft_strtrim(skip_spaces(trimmed + 2), " ");
+		game->texture_we = arena_strtrim(&game->arena, trimmed + 2, " ");
 	else if (!ft_strncmp(trimmed, "EA", 2))
-		game->texture_ea = ft_strtrim(skip_spaces(trimmed + 2), " ");
+		game->texture_ea = arena_strtrim(&game->arena, trimmed + 2, " ");
 	else if (!ft_strncmp(trimmed, "F", 1))
 		parse_color(skip_spaces(trimmed + 1), game->floor_color);
 	else if (!ft_strncmp(trimmed, "C", 1))
 		parse_color(skip_spaces(trimmed + 1), game->c_color);
 	else if (!ft_strncmp(trimmed, "D", 1))
-		game->texture_door = ft_strtrim(skip_spaces(trimmed + 1), " ");
+		game->texture_door = arena_strtrim(&game->arena, trimmed + 1, " ");
 	else if (!ft_strncmp(trimmed, "M", 1))
-		game->texture_door_w = ft_strtrim(skip_spaces(trimmed + 1), " ");
+		game->texture_door_w = arena_strtrim(&game->arena, trimmed + 1, " ");
 	else if (!ft_strncmp(trimmed, "B", 1))
-		game->texture_enemy = ft_strtrim(skip_spaces(trimmed + 1), " ");
+		game->texture_enemy = arena_strtrim(&game->arena, trimmed + 1, " ");
 	else if (!ft_strncmp(trimmed, "WAP", 3))
-		game->texture_weapon = ft_strtrim(skip_spaces(trimmed + 3), " ");
+		game->texture_weapon = arena_strtrim(&game->arena, trimmed + 3, " ");
 }
 
 /* ************************************************************************** */
@@ -118,12 +127,12 @@ static void	process_texture(char *trimmed, t_game *game)
 /*   - A texture or color definition.                                         */
 /*   - An empty line (ignored).                                               */
 /*                                                                            */
-/*   - Stores map lines dynamically using `ft_realloc()` and `ft_strdup()`.   */
+/*   - Copies map rows into the level arena, in the map array reserved by     */
+/*     `process_lines()`.                                                     */
 /*   - Calls `process_texture()` for texture/color definitions.               */
 /*                                                                            */
 /* ************************************************************************** */
-static void	process_txt_col_map(char *line, t_game *game, char ***temp_map,
-		int *lines)
+static void	process_txt_col_map(char *line, t_game *game, int *lines)
 {
 	static int	map_started = 0;
 	char		*trimmed;
@@ -132,9 +141,9 @@ static void	process_txt_col_map(char *line, t_game *game, char ***temp_map,
 	if (map_started || trimmed[0] == '1')
 	{
 		map_started = 1;
-		*temp_map = ft_realloc(*temp_map, ((*lines) + 1) * sizeof(char *));
-		(*temp_map)[*lines] = ft_strdup(line);
-		(*lines)++;
+		game->map[*lines] = arena_strtrim(&game->arena, line, "");
+		if (!game->map[(*lines)++])
+			exit(write(2, "Error\nOut of memory\n", 20));
 	}
 	else if (*trimmed == '\0')
 		return ;
@@ -142,7 +151,8 @@ static void	process_txt_col_map(char *line, t_game *game, char ***temp_map,
 		|| !ft_strncmp(trimmed, "WE", 2) || !ft_strncmp(trimmed, "EA", 2)
 		|| !ft_strncmp(trimmed, "F", 1) || !ft_strncmp(trimmed, "C", 1)
 		|| !ft_strncmp(trimmed, "D", 1) || !ft_strncmp(trimmed, "M", 1)
-		|| !ft_strncmp(trimmed, "B", 1) || !ft_strncmp(trimmed, "WAP", 3))
+		|| !ft_strncmp(trimmed, "B", 1) || !ft_strncmp(trimmed, "WAP", 3)
+		|| !ft_strncmp(trimmed, "GR", 2))
 		process_texture(trimmed, game);
 }
 
@@ -151,7 +161,8 @@ static void	process_txt_col_map(char *line, t_game *game, char ***temp_map,
 /*   Processes all lines from the map file and validates the final structure. */
 /*                                                                            */
 /*   - Reads and classifies each line.                                        */
-/*   - Stores the map as a dynamic array (`temp_map`).                        */
+/*   - Stores the map in the level arena, in an array with room for every     */
+/*     line of the file.                                                      */
 /*   - Calls `validate_map()` to ensure the map's correctness.                */
 /*   - Checks that all required textures are present.                         */
 /*   - Ensures floor and ceiling colors are properly defined.                 */
@@ -160,15 +171,15 @@ static void	process_txt_col_map(char *line, t_game *game, char ***temp_map,
 void	process_lines(char **lines, int c, t_game *game, t_camera *camera)
 {
 	int		lines_count;
-	char	**temp_map;
 	int		i;
 
+	game->map = arena_alloc(&game->arena, (c + 1) * sizeof(char *));
+	if (!game->map)
+		exit(write(2, "Error\nOut of memory\n", 20));
 	lines_count = 0;
-	temp_map = NULL;
 	i = -1;
 	while (++i < c)
-		process_txt_col_map(lines[i], game, &temp_map, &lines_count);
-	game->map = temp_map;
+		process_txt_col_map(lines[i], game, &lines_count);
 	game->map_height = lines_count;
 	validate_map(game, camera);
 	if (!game->texture_no || !game->texture_so
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/28 22:51:37 by victor            #+#    #+#             */
-/*   Updated: 2025/04/20 11:36:59 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,6 +24,28 @@ char	*skip_spaces(char *s)
 	return (s);
 }
 
+/* ************************************************************************** */
+/*                                                                            */
+/*   Parses the optional floor (FT), ceiling (CT) and thin wall (GR) texture  */
+/*   paths.                                                                   */
+/*                                                                            */
+/*   - Copies the trimmed path into the level arena.                          */
+/*   - Returns 1 if the line was one of them, 0 otherwise.                    */
+/*                                                                            */
+/* ************************************************************************** */
+int	parse_extra_texture(char *trimmed, t_game *game)
+{
+	if (!ft_strncmp(trimmed, "FT", 2))
+		game->texture_floor = arena_strtrim(&game->arena, trimmed + 2, " ");
+	else if (!ft_strncmp(trimmed, "CT", 2))
+		game->texture_ceil = arena_strtrim(&game->arena, trimmed + 2, " ");
+	else if (!ft_strncmp(trimmed, "GR", 2))
+		game->texture_thin = arena_strtrim(&game->arena, trimmed + 2, " ");
+	else
+		return (0);
+	return (1);
+}
+
 /* ************************************************************************** */
 /*                                                                            */
 /*   Processes a line read from the file and stores it in a dynamic array.    */
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipeline_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:21:05 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:22:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Copies the live game state the next frame is rendered from into the      */
+/*   render context. Called while the render thread is idle.                  */
+/*                                                                            */
+/*   - Camera, doors, enemies, weapon and hit feedback are the only state     */
+/*     the simulation changes; everything else in the context is render       */
+/*     state or read-only (map, textures, settings).                          */
+/*   - Door animation flags the render cache on the live app; the flag is     */
+/*     moved to the context so no door change is lost between two frames.     */
+/*   - Doors opened or closed since the last frame are reported to their      */
+/*     subscribers (`dispatch_door_events`): the light map (shared with the   */
+/*     context) is rebaked around them. The flags they leave on the live app  */
+/*     are moved to the context the same way: a changed light map drops its   */
+/*     cached world, and the minimap is redrawn.                              */
+/*                                                                            */
+/* ************************************************************************** */
+static void	snapshot_state(t_app *app)
+{
+	t_app	*ctx;
+
+	ctx = app->worker.ctx;
+	ctx->cam = app->cam;
+	ctx->weapon = app->weapon;
+	ctx->player_hit_feedback = app->player_hit_feedback;
+	app->worker.input_time = app->pacer.input_time;
+	dispatch_door_events(app);
+	ft_memcpy(ctx->game.doors, app->game.doors,
+		app->game.door_count * sizeof(t_door));
+	ft_memcpy(ctx->game.enemies, app->game.enemies,
+		app->game.enemy_count * sizeof(t_enemy));
+	if (app->cache.doors_dirty)
+		ctx->cache.doors_dirty = true;
+	if (app->cache.light_dirty)
+		ctx->cache.valid = false;
+	if (app->layers.dirty[LAYER_MINIMAP])
+		ctx->layers.dirty[LAYER_MINIMAP] = true;
+	app->cache.doors_dirty = false;
+	app->cache.light_dirty = false;
+	app->layers.dirty[LAYER_MINIMAP] = false;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Shows the frame the render thread finished. Runs on the MLX thread.      */
+/*                                                                            */
+/*   - A redrawn world is swapped in: the window image and the back image     */
+/*     exchange their pixel buffers, so MLX never uploads a half-drawn        */
+/*     frame. An unchanged world keeps the current buffer.                    */
+/*   - The HUD layers (minimap, weapon, effects) are drawn here from the      */
+/*     same snapshot, so they always match the world they are stacked on.     */
+/*   - A fully retraced frame feeds the resolution controller, which may      */
+/*     resize the world image and therefore needs the MLX thread.             */
+/*   - The frame's input-to-present latency is recorded (`record_present`).   */
+/*                                                                            */
+/* ************************************************************************** */
+static void	present_frame(t_app *app)
+{
+	t_app		*ctx;
+	uint8_t		*px;
+
+	ctx = app->worker.ctx;
+	if (ctx->layers.dirty[LAYER_WORLD])
+	{
+		px = app->image->pixels;
+		app->image->pixels = app->worker.back->pixels;
+		app->worker.back->pixels = px;
+	}
+	if (ctx->layers.dirty[LAYER_MINIMAP])
+		render_minimap(ctx);
+	if (ctx->layers.dirty[LAYER_WEAPON])
+		render_weapon(ctx);
+	if (ctx->layers.dirty[LAYER_EFFECTS])
+		render_hit_feedback(ctx);
+	ft_bzero(ctx->layers.dirty, sizeof(ctx->layers.dirty));
+	if (app->worker.frame_ms >= 0.0)
+		update_view_scale(ctx, app->worker.frame_ms);
+	app->worker.pending = false;
+	record_present(app, app->worker.input_time);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Per-frame MLX hook: a two-stage pipeline with the render thread.         */
+/*                                                                            */
+/*   1. Simulates frame N + 1 (`move_camera`) on the live state while the     */
+/*      render thread is still drawing frame N from its snapshot.             */
+/*   2. Waits for frame N and presents it (`present_frame`).                  */
+/*   3. Snapshots the state of frame N + 1 and hands it to the render         */
+/*      thread.                                                               */
+/*   4. Idles until the next frame is due (`pace_frame`), then returns so     */
+/*      MLX displays frame N.                                                 */
+/*                                                                            */
+/*   The window shows the same state as before (the frame rendered before     */
+/*   the last simulation step); simulation and rendering now overlap.         */
+/*                                                                            */
+/* ************************************************************************** */
+void	run_frame(void *param)
+{
+	t_app			*app;
+	t_render_thread	*w;
+
+	app = param;
+	w = &app->worker;
+	move_camera(app);
+	pthread_mutex_lock(&w->lock);
+	while (w->busy)
+		pthread_cond_wait(&w->cond, &w->lock);
+	pthread_mutex_unlock(&w->lock);
+	if (w->pending)
+		present_frame(app);
+	snapshot_state(app);
+	pthread_mutex_lock(&w->lock);
+	w->busy = true;
+	w->pending = true;
+	pthread_cond_broadcast(&w->cond);
+	pthread_mutex_unlock(&w->lock);
+	pace_frame(app);
+}
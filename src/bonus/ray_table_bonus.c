@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ray_table_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:01:39 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:34 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Allocates the ray table for views up to `max_w` columns.                 */
+/*   Returns -1 on allocation failure.                                        */
+/*                                                                            */
+/* ************************************************************************** */
+int	init_ray_table(t_ray_table *t, int max_w)
+{
+	t->w = 0;
+	t->cam_x = ft_calloc(max_w, sizeof(double));
+	t->dir = ft_calloc(max_w, sizeof(t_vec2));
+	if (!t->cam_x || !t->dir)
+		return (-1);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Per-frame ray setup, run before any pass that needs camera rays.         */
+/*                                                                            */
+/*   - cam_x (camera-space X of each column) only depends on the view width   */
+/*     and is rebuilt when it changes:                                        */
+/*       cam_x[x] = 2 * x / w - 1                                             */
+/*   - Camera-space rays are (cam_x, 1). The world direction is that vector   */
+/*     through the camera matrix [plane dir], one multiply-add per axis:      */
+/*       dir[x] = cam.dir + cam.plane * cam_x[x]                              */
+/*   - inv_det is the determinant of the inverse matrix, used to bring        */
+/*     world points back to camera space (`to_camera_space`).                 */
+/*                                                                            */
+/* ************************************************************************** */
+void	update_ray_table(t_app *app)
+{
+	t_ray_table	*t;
+	int			x;
+
+	t = &app->rays;
+	x = -1;
+	if (t->w != app->view.w)
+		while (++x < app->view.w)
+			t->cam_x[x] = 2 * x / (double)app->view.w - 1;
+	t->w = app->view.w;
+	x = -1;
+	while (++x < t->w)
+	{
+		t->dir[x].x = app->cam.dir.x + app->cam.plane.x * t->cam_x[x];
+		t->dir[x].y = app->cam.dir.y + app->cam.plane.y * t->cam_x[x];
+	}
+	t->inv_det = 1.0 / (app->cam.plane.x * app->cam.dir.y
+			- app->cam.dir.x * app->cam.plane.y);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Transforms a point relative to the camera into camera space.             */
+/*                                                                            */
+/*   - x: position along the camera plane, y: depth along dir:                */
+/*       x = inv_det * (dir.y * rel.x - dir.x * rel.y)                        */
+/*       y = inv_det * (plane.x * rel.y - plane.y * rel.x)                    */
+/*   - A point projects to column (w / 2) * (1 + x / y).                      */
+/*                                                                            */
+/* ************************************************************************** */
+t_vec2	to_camera_space(const t_app *app, t_vec2 rel)
+{
+	t_vec2	t;
+
+	t.x = app->rays.inv_det * (app->cam.dir.y * rel.x
+			- app->cam.dir.x * rel.y);
+	t.y = app->rays.inv_det * (-app->cam.plane.y * rel.x
+			+ app->cam.plane.x * rel.y);
+	return (t);
+}
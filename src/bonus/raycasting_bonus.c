@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/29 13:50:51 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:28:38 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:08:30 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -79,12 +79,50 @@ static void	update_ray_position(t_ray *ray)
 	}
 }
 
+/* ************************************************************************** */
+/*                                                                            */
+/*   Distance `t` where the ray crosses the middle of the cell the DDA just   */
+/*   entered, on the plane across `axis` (0: x = map_x + 0.5, 1: y).          */
+/*                                                                            */
+/*   - `sidedist` holds the distance of the next grid line on each axis and   */
+/*     the cell is `deltadist` wide, so the middle is half a step back:       */
+/*       t = sidedist_x - deltadist_x / 2                                     */
+/*     No division, and nothing is computed for cells without such a plane.   */
+/*   - Returns true if the crossing lies inside the cell, that is between     */
+/*     the distances where the ray enters and leaves it. A ray parallel to    */
+/*     the plane gets NaN and never crosses it.                               */
+/*                                                                            */
+/* ************************************************************************** */
+bool	mid_plane(const t_ray *ray, int axis, double *t)
+{
+	double	enter;
+
+	if (axis == 0)
+		*t = ray->sidedist.x - 0.5 * ray->deltadist.x;
+	else
+		*t = ray->sidedist.y - 0.5 * ray->deltadist.y;
+	if (ray->side == 0)
+		enter = ray->sidedist.x - ray->deltadist.x;
+	else
+		enter = ray->sidedist.y - ray->deltadist.y;
+	return (*t >= enter && *t <= fmin(ray->sidedist.x, ray->sidedist.y));
+}
+
 /* ************************************************************************** */
 /*                                                                            */
 /*   Loops DDA steps until a wall or a door collision is found.               */
 /*                                                                            */
 /*   - Keeps updating the ray position with `update_ray_position()`.          */
-/*   - Stops when hitting a wall ('1') or a valid door ('2' or '3').          */
+/*   - Flags the ray when it enters a door cell, so the render cache knows    */
+/*     the column must be retraced when a door moves.                         */
+/*   - Stops when hitting a wall ('1') or the panel of a door ('2' or '3'),   */
+/*     a plane in the middle of its cell; the ray goes through the gap of an  */
+/*     opening door (`check_door_collision()`).                               */
+/*   - Partial-height cells (BLOCK_TILES) are recorded with `add_slab()` when */
+/*     the ray collects them (`ray->slab`), and the ray goes on behind them   */
+/*     until the column is covered. Other rays pass through them.             */
+/*   - Thin walls (THIN_TILES) stop the ray when it crosses them, unless      */
+/*     they are see-through and the ray collects them (`add_thin()`).         */
 /*                                                                            */
 /* ************************************************************************** */
 static void	dda_loop(t_app *app, t_ray *ray)
@@ -95,9 +133,17 @@ static void	dda_loop(t_app *app, t_ray *ray)
 		ray->hit_tile = safe_get_tile(&app->game, ray->map_x, ray->map_y);
 		if (ray->hit_tile == '1')
 			break ;
-		if ((ray->hit_tile == '2' || ray->hit_tile == '3')
-			&& check_door_collision(app, ray))
+		if (ray->slab && ft_strchr(BLOCK_TILES, ray->hit_tile)
+			&& add_slab(app, ray))
+			break ;
+		if (ft_strchr(THIN_TILES, ray->hit_tile) && add_thin(app, ray))
 			break ;
+		if (ray->hit_tile == '2' || ray->hit_tile == '3')
+		{
+			ray->door = true;
+			if (check_door_collision(app, ray))
+				break ;
+		}
 	}
 }
 
@@ -107,20 +153,23 @@ static void	dda_loop(t_app *app, t_ray *ray)
 /*                                                                            */
 /*   - Initializes step directions and side distances using `init_step()`.    */
 /*   - Traces the ray through the map using `dda_loop()`.                     */
-/*   - Calculates the perpendicular wall distance for correct perspective.    */
+/*   - Calculates the perpendicular wall distance for correct perspective,    */
+/*     unless the ray stopped on a door or a thin wall, in the middle of a    */
+/*     cell: their distance and side are already set.                         */
 /*                                                                            */
 /*   Perpendicular wall distance formula:                                     */
 /*                                                                            */
 /*     If the wall was hit along x:                                           */
-/*       perpwalldist = (sidedist_x - deltadist_x) / |raydir|                 */
+/*       perpwalldist = sidedist_x - deltadist_x                              */
 /*                                                                            */
 /*     If the wall was hit along y:                                           */
-/*       perpwalldist = (sidedist_y - deltadist_y) / |raydir|                 */
+/*       perpwalldist = sidedist_y - deltadist_y                              */
 /*                                                                            */
 /*   where:                                                                   */
 /*     - sidedist is the accumulated distance to the wall side.               */
 /*     - deltadist is the distance between sides in that axis.                */
-/*     - |raydir| is the ray's original direction vector magnitude.           */
+/*     Both are measured in multiples of raydir, whose component along dir    */
+/*     is 1, so the result is already perpendicular to the camera plane.      */
 /*                                                                            */
 /* ************************************************************************** */
 void	do_dda(t_app *app, t_ray *ray)
@@ -136,10 +185,11 @@ void	do_dda(t_app *app, t_ray *ray)
 	ray->step.y = steps.x;
 	ray->sidedist.y = steps.y;
 	dda_loop(app, ray);
+	if (ray->hit_tile == '2' || ray->hit_tile == '3'
+		|| ft_strchr(THIN_TILES, ray->hit_tile))
+		return ;
 	if (ray->side == 0)
-		ray->perpwalldist = (ray->sidedist.x - ray->deltadist.x)
-			/ ray->raydir_mod;
+		ray->perpwalldist = ray->sidedist.x - ray->deltadist.x;
 	else
-		ray->perpwalldist = (ray->sidedist.y - ray->deltadist.y)
-			/ ray->raydir_mod;
+		ray->perpwalldist = ray->sidedist.y - ray->deltadist.y;
 }
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:23:15 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:00:58 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:16:34 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,52 +14,89 @@
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Computes the vertical drawing boundaries for a wall slice.               */
+/*   Draws a cached wall column at screen X.                                  */
 /*                                                                            */
-/*   - The line height (`lh`) is inversely proportional to the perpendicular  */
-/*     wall distance:                                                         */
-/*        lh = HEIGHT / perpwalldist                                          */
+/*   - The line height (`lh`) was stored when the column was traced:          */
+/*        lh = view.h / perpwalldist                                          */
 /*     So, closer walls appear taller, and farther walls shorter.             */
 /*                                                                            */
-/*   - The starting (`ds`) and ending (`de`) pixel coordinates are then       */
-/*     computed to vertically center the wall slice on the screen, adjusted   */
-/*     by the camera's vertical offset (`view_z`) to allow looking up/down.   */
-/*                                                                            */
-/*   - We clamp `ds` and `de` to stay inside the screen bounds.               */
+/*   - The starting (`ds`) and ending (`de`) pixel coordinates are computed   */
+/*     here to vertically center the wall slice on the render view, adjusted  */
+/*     by the camera's vertical offset (`view.z`, view_z scaled to the view   */
+/*     height) to allow looking up/down.                                      */
+/*     Keeping this step apart from the DDA lets the render cache redraw      */
+/*     columns when only `view_z` changed.                                    */
+/*                                                                            */
+/*   - Partial-height cells in front of the wall are drawn first, front to    */
+/*     back (`draw_slabs`). They leave the span of rows still open, and `ds`  */
+/*     and `de` are clamped to it (the whole view without slabs), so no       */
+/*     pixel of the column is drawn twice.                                    */
+/*   - A column covered by slabs alone has no wall texture.                   */
+/*   - See-through walls in front are drawn last, back to front, over what    */
+/*     lies behind them (`draw_thins`). Columns without them keep the plain   */
+/*     opaque path.                                                           */
 /*                                                                            */
 /* ************************************************************************** */
-static void	compute_draw_boundaries(t_draw *draw, t_ray *ray, t_app *app)
+void	draw_wall_column(t_app *app, int x)
 {
-	draw->lh = (int)(HEIGHT / ray->perpwalldist);
-	draw->ds = -draw->lh / 2 + HEIGHT / 2 - app->cam.view_z;
-	if (draw->ds < 0)
-		draw->ds = 0;
-	draw->de = draw->lh / 2 + HEIGHT / 2 - app->cam.view_z;
-	if (draw->de >= HEIGHT)
-		draw->de = HEIGHT - 1;
+	t_column	*col;
+	t_draw		*draw;
+	int			open[2];
+
+	col = &app->cache.cols[x];
+	draw = &col->draw;
+	draw_slabs(app, x, open);
+	app->z_buffer[x] = col->dist;
+	if (draw->tex)
+	{
+		draw->ds = -draw->lh / 2 + app->view.h / 2 - app->view.z;
+		if (draw->ds < open[0])
+			draw->ds = open[0];
+		draw->de = draw->lh / 2 + app->view.h / 2 - app->view.z;
+		if (draw->de > open[1])
+			draw->de = open[1];
+		draw_pixels(app, x, draw, col->dist);
+	}
+	if (col->thins)
+		draw_thins(app, x);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Renders a column of pixels for the given ray at the specified X.        */
+/*   Traces the ray of screen column X and renders it.                        */
 /*                                                                            */
-/*   - First, it computes the boundaries of the vertical line (column) to    */
-/*     be drawn using `compute_draw_boundaries()`.                            */
-/*   - It then calculates the texture parameters and applies them to the     */
-/*     drawing process using `compute_texture_params()`.                     */
-/*   - Finally, it draws the pixels for the column by calling `draw_pixels()`.*/
+/*   - Initializes the ray (`init_ray`) and runs the DDA (`do_dda`), which    */
+/*     collects the partial-height cells and see-through walls it crosses     */
+/*     into the column's slots of `cache.slabs` and `cache.thins`.            */
+/*   - Stores the hit in the render cache: distance, line height, texture     */
+/*     parameters (`compute_texture_params`), whether a door was crossed and  */
+/*     the light map sampled just in front of the hit point. When the slabs   */
+/*     covered the column before any wall, there is no wall to draw.          */
+/*   - Draws the column from the cache with `draw_wall_column()`.             */
 /*                                                                            */
 /* ************************************************************************** */
-static void	render_column(t_app *app, int x, t_ray *ray)
+void	trace_wall_column(t_app *app, int x)
 {
-	t_draw	draw;
+	t_ray		ray;
+	t_column	*col;
 
-	compute_draw_boundaries(&draw, ray, app);
-	compute_texture_params(app, ray, &draw);
-	if (!draw.tex)
-		return ;
-	app->z_buffer[x] = ray->perpwalldist;
-	draw_pixels(app, x, &draw);
+	col = &app->cache.cols[x];
+	init_ray(app, app->rays.dir[x], &ray);
+	ray.slab = &app->cache.slabs[x * COLUMN_SLABS];
+	ray.thin = &app->cache.thins[x * COLUMN_THINS];
+	do_dda(app, &ray);
+	col->dist = ray.perpwalldist;
+	col->door = ray.door;
+	col->slabs = ray.slabs;
+	col->thins = ray.thins;
+	col->draw.lh = (int)(app->view.h / ray.perpwalldist);
+	compute_texture_params(app, &ray, &col->draw);
+	if (ft_strchr(BLOCK_TILES, ray.hit_tile))
+		col->draw.tex = NULL;
+	col->draw.light = light_at(&app->game.light,
+			app->cam.pos.x + ray.raydir.x * (ray.perpwalldist - 0.01),
+			app->cam.pos.y + ray.raydir.y * (ray.perpwalldist - 0.01));
+	draw_wall_column(app, x);
 }
 
 /* ************************************************************************** */
@@ -103,67 +140,71 @@ static void	sort_enemies_by_distance(t_enemy **enemies, int count, t_app *a)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Sorts enemies by distance and renders them in correct order.             */
-/*                                                                            */
-/*   - Allocates a temporary array to sort pointers to enemies without        */
-/*     modifying the original enemy array.                                    */
+/*   Marks the dirty layers and redraws the world layer if it is one.         */
 /*                                                                            */
-/*   - Only active enemies (`is_active == 1`) are rendered.                   */
-/*                                                                            */
-/*   - After rendering, the temporary array is freed.                         */
+/*   - The enemies drawn this frame are collected first (`visible_sprites`)   */
+/*     into an array of pointers from the frame arena, so their signature     */
+/*     can decide whether the world layer is dirty (`update_layers`).         */
+/*   - A dirty world layer is upscaled (`present_scene`) and the collected    */
+/*     enemies are drawn over it, sorted by distance, without modifying the   */
+/*     original enemy array.                                                  */
 /*                                                                            */
 /* ************************************************************************** */
-static void	sort_and_render(t_app *a)
+static void	draw_world_layer(t_app *a, t_cache_mode mode, bool doors)
 {
-	t_enemy	**sorted;
-	int		i;
+	t_enemy		**sprites;
+	uint64_t	sig;
+	int			n;
+	int			i;
 
-	sorted = malloc(a->game.enemy_count * sizeof(t_enemy *));
-	if (!sorted)
+	sprites = arena_alloc(&a->frame,
+			(a->game.enemy_count + 1) * sizeof(t_enemy *));
+	n = 0;
+	sig = 0;
+	if (sprites)
+		n = visible_sprites(a, sprites, &sig);
+	update_layers(a, mode, doors, sig);
+	if (!a->layers.dirty[LAYER_WORLD])
 		return ;
+	present_scene(a);
+	sort_enemies_by_distance(sprites, n, a);
 	i = -1;
-	while (++i < a->game.enemy_count)
-		sorted[i] = &a->game.enemies[i];
-	sort_enemies_by_distance(sorted, a->game.enemy_count, a);
-	i = -1;
-	while (++i < a->game.enemy_count)
-		if (sorted[i]->is_active)
-			render_enemy(a, sorted[i]);
-	free(sorted);
+	while (++i < n)
+		render_enemy(a, sprites[i]);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Renders the full scene for the current frame.                            */
+/*   Renders the world of one frame; runs on the render thread.               */
 /*                                                                            */
+/*   - `a` is the render-side copy of the app, holding a snapshot of the      */
+/*     camera, doors, enemies and HUD state (see `run_frame`).                */
+/*   - Frame temporaries come from `a->frame`, rewound here, so no memory is  */
+/*     allocated once the arena has reached its peak size.                    */
 /*   - Steps:                                                                 */
-/*      1. Draws the background (sky and floor).                              */
-/*      2. For each column (screen X-coordinate):                             */
-/*          - Initializes a ray for that column (`init_ray`).                 */
-/*          - Performs DDA to detect wall hit (`do_dda`).                     */
-/*          - Renders the vertical slice of wall (`render_column`).           */
-/*      3. Draws the minimap on top.                                          */
-/*      4. Renders enemies (sorted by distance).                              */
-/*      5. Renders player's weapon and damage feedback effects.               */
+/*      1. Updates the world (sky, floor and walls) at the internal render    */
+/*         resolution through the render cache (`render_world`), which only   */
+/*         redoes what changed.                                               */
+/*      2. Marks the window layers whose inputs changed, and if the world     */
+/*         layer is one, upscales it into the back image and draws the        */
+/*         enemies on screen over it (`draw_world_layer`). The HUD layers     */
+/*         are drawn later by the MLX thread.                                 */
+/*   - Returns the cost in ms of a frame that retraced the whole view, for    */
+/*     the resolution controller, or -1 for cached frames.                    */
 /*                                                                            */
 /* ************************************************************************** */
-void	render_scene(void *param)
+double	render_scene(t_app *a)
 {
-	t_app	*a;
-	int		x;
-	t_ray	r;
+	double			start;
+	t_cache_mode	mode;
+	bool			doors;
 
-	a = param;
-	ft_draw_background(a);
-	x = -1;
-	while (++x < WIDTH)
-	{
-		init_ray(a, x, &r);
-		do_dda(a, &r);
-		render_column(a, x, &r);
-	}
-	render_minimap(a);
-	sort_and_render(a);
-	render_weapon(a);
-	render_hit_feedback(a);
+	start = mlx_get_time();
+	arena_reset(&a->frame);
+	doors = a->cache.doors_dirty;
+	mode = render_world(a);
+	draw_world_layer(a, mode, doors);
+	if (mode != CACHE_MISS)
+		return (-1.0);
+	return ((mlx_get_time() - start) * 1000.0);
 }
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_thread_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:20:41 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:37:35 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Body of the render thread.                                               */
+/*                                                                            */
+/*   - Sleeps until `run_frame` hands it a frame (`busy`), renders the world  */
+/*     of the snapshot into the back image, then clears `busy` and wakes the  */
+/*     MLX thread, which may be waiting to present.                           */
+/*   - The lock is released while rendering: the MLX thread only touches the  */
+/*     live game state in the meantime, never the render context.             */
+/*                                                                            */
+/* ************************************************************************** */
+static void	*render_worker(void *param)
+{
+	t_render_thread	*w;
+	double			frame_ms;
+
+	w = param;
+	pthread_mutex_lock(&w->lock);
+	while (true)
+	{
+		while (!w->busy && !w->quit)
+			pthread_cond_wait(&w->cond, &w->lock);
+		if (w->quit)
+			break ;
+		pthread_mutex_unlock(&w->lock);
+		frame_ms = render_scene(w->ctx);
+		pthread_mutex_lock(&w->lock);
+		w->frame_ms = frame_ms;
+		w->busy = false;
+		pthread_cond_broadcast(&w->cond);
+	}
+	pthread_mutex_unlock(&w->lock);
+	return (NULL);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Builds the render context: a copy of the app owned by the render         */
+/*   thread.                                                                  */
+/*                                                                            */
+/*   - Render state (view, caches, tables, layers) lives on in the copy from  */
+/*     now on; the app keeps the same buffers only to free them.              */
+/*   - The world is drawn into `back`, an off-screen image swapped with the   */
+/*     window image on present, and doors and enemies get their own arrays    */
+/*     (from the level arena) that `run_frame` refreshes from the live game   */
+/*     every frame. The copy also owns the per-frame scratch arena.           */
+/*                                                                            */
+/* ************************************************************************** */
+static int	init_render_context(t_app *app)
+{
+	t_render_thread	*w;
+	t_app			*ctx;
+
+	w = &app->worker;
+	w->back = mlx_new_image(app->mlx, app->cfg.width, app->cfg.height);
+	w->ctx = ft_calloc(1, sizeof(t_app));
+	if (!w->back || !w->ctx)
+		return (-1);
+	*w->ctx = *app;
+	ctx = w->ctx;
+	ctx->image = w->back;
+	ctx->frame = (t_arena){.block_size = FRAME_ARENA_BLOCK};
+	ctx->game.doors = arena_alloc(&app->game.arena,
+			(app->game.door_count + 1) * sizeof(t_door));
+	ctx->game.enemies = arena_alloc(&app->game.arena,
+			(app->game.enemy_count + 1) * sizeof(t_enemy));
+	if (!ctx->game.doors || !ctx->game.enemies)
+		return (-1);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Creates the render context and starts the render thread.                 */
+/*   Returns -1 on failure, 0 on success.                                     */
+/*                                                                            */
+/* ************************************************************************** */
+int	start_render_thread(t_app *app)
+{
+	t_render_thread	*w;
+
+	w = &app->worker;
+	if (init_render_context(app) == -1)
+		return (printf("Error: Failed to create the render context\n"),
+			cleanup(app), -1);
+	pthread_mutex_init(&w->lock, NULL);
+	pthread_cond_init(&w->cond, NULL);
+	w->running = true;
+	if (pthread_create(&w->thread, NULL, render_worker, w) != 0)
+	{
+		w->running = false;
+		pthread_mutex_destroy(&w->lock);
+		pthread_cond_destroy(&w->cond);
+		return (printf("Error: Failed to start the render thread\n"),
+			cleanup(app), -1);
+	}
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Waits for the frame in flight, stops the render thread and frees the     */
+/*   render context. Safe to call when the thread never started.              */
+/*                                                                            */
+/* ************************************************************************** */
+void	stop_render_thread(t_app *app)
+{
+	t_render_thread	*w;
+
+	w = &app->worker;
+	if (w->running)
+	{
+		pthread_mutex_lock(&w->lock);
+		w->quit = true;
+		pthread_cond_broadcast(&w->cond);
+		pthread_mutex_unlock(&w->lock);
+		pthread_join(w->thread, NULL);
+		pthread_mutex_destroy(&w->lock);
+		pthread_cond_destroy(&w->cond);
+		w->running = false;
+	}
+	if (w->ctx)
+	{
+		arena_free(&w->ctx->frame);
+		free(w->ctx);
+		w->ctx = NULL;
+	}
+}
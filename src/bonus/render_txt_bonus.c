@@ -6,38 +6,17 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/18 19:15:16 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:05:59 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:39:12 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3D_bonus.h"
 
-/* ************************************************************************** */
-/*                                                                            */
-/*   Finds the door at a given map position (x, y), if it exists.             */
-/*                                                                            */
-/*   - Iterates over all doors stored in the game.                            */
-/*   - Returns a pointer to the matching door if found, NULL otherwise.       */
-/*                                                                            */
-/* ************************************************************************** */
-static t_door	*get_door(t_game *g, int x, int y)
-{
-	int	i;
-
-	i = 0;
-	while (i < g->door_count)
-	{
-		if (g->doors[i].x == x && g->doors[i].y == y)
-			return (&g->doors[i]);
-		i++;
-	}
-	return (NULL);
-}
-
 /* ************************************************************************** */
 /*                                                                            */
 /*   Selects the appropriate wall texture based on ray direction and side.    */
 /*                                                                            */
+/*   - Thin walls use their own texture (`tex_thin`) when there is one.       */
 /*   - Checks if the adjacent tile is a door ('2' or '3') depending on side.  */
 /*     If so, returns the door wall texture (`tex_door_w`).                   */
 /*                                                                            */
@@ -50,6 +29,8 @@ static mlx_texture_t	*get_wall_texture(t_app *app, t_ray *ray)
 {
 	char	adj;
 
+	if (ft_strchr(THIN_TILES, ray->hit_tile) && app->game.tex_thin)
+		return (app->game.tex_thin);
 	if (ray->side == 0)
 		adj = safe_get_tile(&app->game, ray->map_x - ray->step.x, ray->map_y);
 	else
@@ -74,34 +55,25 @@ static mlx_texture_t	*get_wall_texture(t_app *app, t_ray *ray)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Selects the correct door texture and adjusts texture coordinate `w`.     */
-/*                                                                            */
-/*   - If the ray hits the door panel (front face), the texture coordinate `w`*/
-/*     is shifted according to the door's opening (`open_offset`).            */
+/*   Selects the door texture and adjusts texture coordinate `w`.             */
 /*                                                                            */
-/*   - For side faces (non-panel), a static door wall texture is used.        */
+/*   - Rays only stop on the panel of a door (`check_door_collision`), so     */
+/*     the texture coordinate `w` is shifted according to the door's opening  */
+/*     (`open_offset`), the panel sliding along with it. The walls on each    */
+/*     side of the door cell get the door wall texture (`get_wall_texture`).  */
 /*                                                                            */
 /*   Math:                                                                    */
 /*     - When a door opens, the visible part of the door panel shifts.        */
 /*     - `fmod` is used to keep the value inside [0.0, 1.0) after shifting.   */
 /*                                                                            */
 /* ************************************************************************** */
-static mlx_texture_t	*get_door_texture(t_game *game, t_door *d,
-		t_ray *ray, double *w)
+static mlx_texture_t	*get_door_texture(t_game *game, t_door *d, double *w)
 {
-	bool	panel_face;
-
-	panel_face = (d->orientation == '2' && ray->side == 1)
-		|| (d->orientation == '3' && ray->side == 0);
-	if (panel_face)
-	{
-		if (d->orientation == '2')
-			*w = fmod(*w - d->open_offset + 1.0, 1.0);
-		else
-			*w = fmod(*w + d->open_offset + 1.0, 1.0);
-		return (game->tex_door);
-	}
-	return (game->tex_door_w);
+	if (d->orientation == '2')
+		*w = fmod(*w - d->open_offset + 1.0, 1.0);
+	else
+		*w = fmod(*w + d->open_offset + 1.0, 1.0);
+	return (game->tex_door);
 }
 
 /* ************************************************************************** */
@@ -142,8 +114,10 @@ static int	compute_tx(mlx_texture_t *t, double w, t_ray *ray)
 /*                                                                            */
 /*    2. Extract the fractional part to determine horizontal position `w`.    */
 /*                                                                            */
-/*    3. If the tile is a door, use special door texture logic (dynamic).     */
-/*       Otherwise, select static wall texture.                               */
+/*    3. If the tile is a door (`find_door`, one collision grid lookup), use  */
+/*       special door texture logic (dynamic).                                */
+/*       Otherwise, select static wall texture (walls, thin walls and the     */
+/*       faces of partial-height cells).                                      */
 /*                                                                            */
 /*    4. Compute the horizontal texture pixel `tx` for rendering.             */
 /*                                                                            */
@@ -152,23 +126,22 @@ void	compute_texture_params(t_app *app, t_ray *ray, t_draw *draw)
 {
 	double			w;
 	mlx_texture_t	*t;
-	t_door			*d;
+	int				i;
 
 	if (ray->side == 0)
 		w = app->cam.pos.y + ray->perpwalldist * ray->raydir.y;
 	else
 		w = app->cam.pos.x + ray->perpwalldist * ray->raydir.x;
 	w -= floor(w);
+	i = -1;
 	if (ray->hit_tile == '2' || ray->hit_tile == '3')
-		d = get_door(&app->game, ray->map_x, ray->map_y);
-	else
-		d = NULL;
-	if (d)
-		t = get_door_texture(&app->game, d, ray, &w);
-	else if (ray->hit_tile == '1')
+		i = find_door(&app->game, ray->map_x, ray->map_y);
+	t = NULL;
+	if (i >= 0)
+		t = get_door_texture(&app->game, &app->game.doors[i], &w);
+	else if (ray->hit_tile == '1' || ft_strchr(BLOCK_TILES, ray->hit_tile)
+		|| ft_strchr(THIN_TILES, ray->hit_tile))
 		t = get_wall_texture(app, ray);
-	else
-		t = NULL;
 	draw->tex = t;
 	if (!t)
 		return ;
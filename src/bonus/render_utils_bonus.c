@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/29 13:20:35 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 21:42:14 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 15:54:57 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,48 +54,37 @@ uint32_t	convert_pixel(uint32_t px)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Initializes background distortion tables and randomizes a light panel.   */
+/*   Initializes background distortion tables.                                */
 /*                                                                            */
 /*   Steps:                                                                   */
 /*    1. Fills `sx` with horizontal sine distortions.                         */
 /*       (small horizontal wavy movement based on sine function)              */
-/*    2. Fills `cam_x_table` to store the camera X coordinate for each column */
-/*    3. Fills `cy` with vertical cosine distortions (wave effect in Y).      */
-/*    4. Randomizes `light_panel` to simulate random flickering lights.       */
+/*    2. Fills `cy` with vertical cosine distortions (wave effect in Y).      */
+/*   The `light_panel` pattern is drawn once when the light map is baked      */
+/*   (the panels are light sources) and survives view resizes.                */
+/*                                                                            */
+/*   The tables are rebuilt whenever the render view size (w x h) changes.    */
 /*                                                                            */
 /*   Math:                                                                    */
 /*     sx[x] = sin(x * 0.4) * 0.08                                            */
-/*     cam_x_table[x] = 2.0 * (x + 0.5) / WIDTH - 1.0                         */
 /*     cy[y] = cos(y * 0.6) * 0.08                                            */
 /*                                                                            */
 /* ************************************************************************** */
-void	init_background_tables(double *sx, double *cy, double *cam_x_table,
-		bool light_panel[225])
+void	init_background_tables(t_bg_tables *t, int w, int h)
 {
-	static bool	init = false;
-	int			x;
-	int			y;
+	int	x;
+	int	y;
 
-	if (init)
+	if (t->w == w && t->h == h)
 		return ;
-	srand((unsigned int)(mlx_get_time() * 100.0));
 	x = -1;
-	while (++x < WIDTH)
-	{
-		sx[x] = sin(x * 0.4) * 0.08;
-		cam_x_table[x] = 2.0 * (x + 0.5) / WIDTH - 1.0;
-	}
+	while (++x < w)
+		t->sx[x] = sin(x * 0.4) * 0.08;
 	y = -1;
-	while (++y < HEIGHT)
-		cy[y] = cos(y * 0.6) * 0.08;
-	x = -1;
-	while (++x < 15)
-	{
-		y = -1;
-		while (++y < 15)
-			light_panel[x * 15 + y] = (rand() % 15) == 0;
-	}
-	init = true;
+	while (++y < h)
+		t->cy[y] = cos(y * 0.6) * 0.08;
+	t->w = w;
+	t->h = h;
 }
 
 /* ************************************************************************** */
@@ -123,49 +112,49 @@ void	calculate_grid_coordinates(t_vec2 world, t_collision *col)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Draws a vertical column of wall pixels with fog effect.                  */
+/*   Draws a vertical column of shaded wall pixels.                           */
 /*                                                                            */
 /*   Steps:                                                                   */
 /*    1. For each screen pixel from `draw->ds` to `draw->de`:                 */
 /*         - Calculate distance-based texture Y coordinate `ty`.              */
 /*         - Fetch the corresponding pixel color from texture.                */
-/*         - Apply a fog effect based on distance stored in `z_buffer[x]`.    */
+/*         - Shade it with the table row for the distance of the surface      */
+/*           (`dist`) and the light map sample of the column (`draw->light`). */
 /*         - Draw the pixel to the screen with `mlx_put_pixel()`.             */
 /*                                                                            */
 /*   Math for ty:                                                             */
-/*     d = (y + view_z) * 256 - HEIGHT * 128 + lh * 128                       */
+/*     d = (y + view.z) * 256 - view.h * 128 + lh * 128                       */
 /*     ty = (d * texture_height / lh) / 256                                   */
 /*                                                                            */
-/*   Fog factor:                                                              */
-/*     fog_factor = max(1.0 / (1.0 + 0.25 * distance), 0.4)                   */
-/*     (minimum fog = 0.4, closer = clearer, farther = foggier)               */
+/*   Shading: one row of the shade table is picked per column (see            */
+/*   shade_lut), so each channel is a single lookup.                          */
 /*                                                                            */
 /* ************************************************************************** */
-void	draw_pixels(t_app *app, int x, t_draw *dr)
+void	draw_pixels(t_app *app, int x, t_draw *dr, double dist)
 {
-	uint8_t		*p[2];
-	uint32_t	*tpx;
-	uint32_t	px;
-	double		f[1];
-	int			i[4];
+	uint8_t			*p[2];
+	uint32_t		*tpx;
+	uint32_t		px;
+	const uint8_t	*lut;
+	int				i[4];
 
-	p[0] = app->image->pixels;
+	p[0] = app->scene->pixels;
 	tpx = (uint32_t *)dr->tex->pixels;
-	f[0] = fmax(1.0 / (1.0 + 0.25 * app->z_buffer[x]), 0.4);
+	lut = app->shade.lut[shade_row(shade_level(dist), dr->light)];
 	i[0] = dr->lh;
 	i[1] = dr->ds - 1;
 	while (++i[1] < dr->de)
 	{
-		if (i[1] >= 0 && i[1] < HEIGHT)
+		if (i[1] >= 0 && i[1] < app->view.h)
 		{
-			i[2] = (i[1] + app->cam.view_z) * 256 - HEIGHT * 128 + i[0] * 128;
+			i[2] = (i[1] + app->view.z) * 256 - app->view.h * 128 + i[0] * 128;
 			i[3] = ((i[2] * dr->tex->height) / i[0]) >> 8;
 			i[3] = (i[3] + dr->tex->height) % dr->tex->height;
-			p[1] = p[0] + (i[1] * app->image->width + x) * 4;
+			p[1] = p[0] + (i[1] * app->scene->width + x) * 4;
 			px = tpx[i[3] * dr->tex->width + dr->tx];
-			p[1][0] = (px & 0xFF) * f[0];
-			p[1][1] = ((px >> 8) & 0xFF) * f[0];
-			p[1][2] = ((px >> 16) & 0xFF) * f[0];
+			p[1][0] = lut[px & 0xFF];
+			p[1][1] = lut[(px >> 8) & 0xFF];
+			p[1][2] = lut[(px >> 16) & 0xFF];
 		}
 	}
 }
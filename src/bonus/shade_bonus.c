@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shade_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:01:01 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 15:43:57 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Builds the distance shade table shared by every render pass.             */
+/*                                                                            */
+/*   - lut[l][c] = c * l / (SHADE_LEVELS - 1), rounded: level 0 is black and  */
+/*     the last level leaves the channel unchanged.                           */
+/*   - The table only depends on the channel value, so the same row shades    */
+/*     R, G and B of a packed pixel in any byte order.                        */
+/*   - The flat floor and ceiling colors are shaded by every row up front,    */
+/*     so those passes store one precomputed pixel per lookup.                */
+/*   - mul[l] is the same row as an 8.8 factor, for kernels that shade with   */
+/*     multiplies instead of table loads (see flat_span).                     */
+/*                                                                            */
+/* ************************************************************************** */
+void	init_shade_table(t_shade *s, const t_game *g)
+{
+	int	l;
+	int	c;
+
+	l = -1;
+	while (++l < SHADE_LEVELS)
+	{
+		c = -1;
+		while (++c < 256)
+			s->lut[l][c] = (c * l + (SHADE_LEVELS - 1) / 2)
+				/ (SHADE_LEVELS - 1);
+		s->floor[l] = shade_color(s->lut[l], g->floor_color);
+		s->ceiling[l] = shade_color(s->lut[l], g->c_color);
+		s->mul[l] = (l * 256 + (SHADE_LEVELS - 1) / 2) / (SHADE_LEVELS - 1);
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns the shade level of a surface at distance `dist`.                 */
+/*                                                                            */
+/*   - One falloff for walls, floor, ceiling and sprites:                     */
+/*       f = max(1 / (1 + SHADE_FALLOFF * dist), SHADE_MIN)                   */
+/*   - f is quantized to SHADE_LEVELS levels; callers compute it once per     */
+/*     column, scanline or sprite.                                            */
+/*                                                                            */
+/* ************************************************************************** */
+int	shade_level(double dist)
+{
+	double	f;
+
+	f = 1.0;
+	if (dist > 0.0)
+		f = 1.0 / (1.0 + SHADE_FALLOFF * dist);
+	if (f < SHADE_MIN)
+		f = SHADE_MIN;
+	return ((int)(f * (SHADE_LEVELS - 1) + 0.5));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Shades a raw (packed) pixel with a table row; alpha is kept.             */
+/*                                                                            */
+/* ************************************************************************** */
+uint32_t	shade_pixel(const uint8_t *lut, uint32_t px)
+{
+	return ((px & 0xFF000000) | (uint32_t)lut[(px >> 16) & 0xFF] << 16
+		| (uint32_t)lut[(px >> 8) & 0xFF] << 8 | lut[px & 0xFF]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Shades an opaque {r, g, b} color and packs it as a raw pixel.            */
+/*                                                                            */
+/* ************************************************************************** */
+uint32_t	shade_color(const uint8_t *lut, const int *color)
+{
+	return (pack_pixel(lut[color[0]], lut[color[1]], lut[color[2]], 255));
+}
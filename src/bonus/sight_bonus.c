@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sight_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:25:17 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:52:25 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Tells whether a see-through wall the sight ray collected hides what      */
+/*   lies behind it: the line of sight crosses it at eye height, the middle   */
+/*   row of its texture column, so only an opaque run over that row blocks.   */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	thin_blocks(const t_app *app, const t_thin *w)
+{
+	const t_mask	*m;
+	int				mid;
+	int				i;
+
+	m = &app->game.thin_mask;
+	mid = app->game.tex_thin->height / 2;
+	i = m->col[w->draw.tx] - 1;
+	while (++i < m->col[w->draw.tx + 1])
+		if (m->run[2 * i] <= mid && mid < m->run[2 * i + 1])
+			return (true);
+	return (false);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Tells whether the player can see the point `to` (and is seen from it).   */
+/*                                                                            */
+/*   - Beyond ENEMY_SIGHT, nothing is seen and no ray is cast.                */
+/*   - Otherwise casts the render DDA (`do_dda`) from the camera with         */
+/*     raydir = to - camera: distances are then fractions of the segment, so  */
+/*     the point is visible if the first wall, closed door panel or opaque    */
+/*     thin wall lies at a distance of 1 or more. Partial-height cells do     */
+/*     not block the view, like for the camera rays.                          */
+/*   - See-through thin walls are collected like for the camera rays and      */
+/*     only block where their texture is opaque at eye height                 */
+/*     (`thin_blocks`). With COLUMN_THINS of them in front, the view counts   */
+/*     as blocked: the ray does not collect the ones past them.               */
+/*   - Runs on the MLX thread with the live state; the render context is      */
+/*     not touched.                                                           */
+/*                                                                            */
+/* ************************************************************************** */
+bool	line_of_sight(t_app *app, t_vec2 to)
+{
+	t_ray	ray;
+	t_thin	thin[COLUMN_THINS];
+	t_vec2	d;
+	int		i;
+
+	d.x = to.x - app->cam.pos.x;
+	d.y = to.y - app->cam.pos.y;
+	if (d.x * d.x + d.y * d.y > ENEMY_SIGHT * ENEMY_SIGHT)
+		return (false);
+	if (d.x * d.x + d.y * d.y < 1e-8)
+		return (true);
+	init_ray(app, d, &ray);
+	ray.thin = thin;
+	do_dda(app, &ray);
+	if (ray.perpwalldist < 1.0)
+		return (false);
+	i = -1;
+	while (++i < ray.thins)
+		if (thin[i].dist < 1.0 && thin_blocks(app, &thin[i]))
+			return (false);
+	return (ray.thins < COLUMN_THINS || thin[COLUMN_THINS - 1].dist >= 1.0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Refreshes the cached line of sight (`sees_player`) of SIGHT_PER_TICK     */
+/*   enemies per tick, round robin from `sight_next`.                         */
+/*                                                                            */
+/*   - The AI reads the cached flag, so a frame casts at most SIGHT_PER_TICK  */
+/*     rays however many enemies there are; each result is at most            */
+/*     enemy_count / SIGHT_PER_TICK ticks old.                                */
+/*   - Dead enemies keep their last result and cost no ray; dormant ones      */
+/*     (`update_lod`) see nothing until they wake.                            */
+/*                                                                            */
+/* ************************************************************************** */
+void	update_sight(t_app *app)
+{
+	t_enemy	*e;
+	int		n;
+
+	n = 0;
+	while (n++ < SIGHT_PER_TICK && n <= app->game.enemy_count)
+	{
+		if (app->game.sight_next >= app->game.enemy_count)
+			app->game.sight_next = 0;
+		e = &app->game.enemies[app->game.sight_next++];
+		if (e->is_active)
+			e->sees_player = e->lod != LOD_DORMANT && line_of_sight(app,
+					(t_vec2){e->pos_x, e->pos_y});
+	}
+}
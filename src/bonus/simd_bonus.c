@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:54:58 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Name of a kernel level, as shown by the benchmark.                       */
+/*                                                                            */
+/* ************************************************************************** */
+const char	*simd_name(t_simd_level level)
+{
+	static const char	*names[SIMD_LEVELS] = {"base", "sse4.2", "avx2",
+		"avx512"};
+
+	return (names[level]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Selects the kernel variants once at startup.                             */
+/*                                                                            */
+/*   - By default (cfg.simd = -1) the best level the CPU supports is used,    */
+/*     so one binary runs the widest kernels on every machine.                */
+/*   - `--simd=<0..3>` forces base, SSE4.2, AVX2 or AVX-512 for testing; a    */
+/*     level the CPU lacks is an error instead of a crash. Outside x86 only   */
+/*     the baseline exists, so any level above 0 is an error there.           */
+/*   - Returns -1 on error, 0 otherwise.                                      */
+/*                                                                            */
+/* ************************************************************************** */
+int	init_kernels(t_app *app)
+{
+	t_simd_level	best;
+
+	best = detect_simd();
+	app->kernels.level = best;
+	if (app->cfg.simd >= 0)
+		app->kernels.level = app->cfg.simd;
+	if (app->kernels.level > best)
+		return (printf("Error: This CPU does not support %s kernels\n",
+				simd_name(app->kernels.level)), -1);
+	select_kernels(&app->kernels);
+	return (0);
+}
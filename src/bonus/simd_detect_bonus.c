@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_detect_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:11:30 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:20 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+#if SIMD_X86
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns the best kernel level this CPU supports (cpuid through the       */
+/*   compiler's `__builtin_cpu_supports`).                                    */
+/*                                                                            */
+/* ************************************************************************** */
+int	detect_simd(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+		return (SIMD_AVX512);
+	if (__builtin_cpu_supports("avx2"))
+		return (SIMD_AVX2);
+	if (__builtin_cpu_supports("sse4.2"))
+		return (SIMD_SSE42);
+	return (SIMD_BASE);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Points the kernels at the variants of `k->level`.                        */
+/*                                                                            */
+/* ************************************************************************** */
+void	select_kernels(t_kernels *k)
+{
+	static const t_row_kernel	nearest[SIMD_LEVELS] = {nearest_row_base,
+		nearest_row_sse42, nearest_row_avx2, nearest_row_avx512};
+	static const t_row_kernel	blend[SIMD_LEVELS] = {blend_rows_base,
+		blend_rows_sse42, blend_rows_avx2, blend_rows_avx512};
+	static const t_row_kernel	stretch[SIMD_LEVELS] = {stretch_row_base,
+		stretch_row_sse42, stretch_row_avx2, stretch_row_avx512};
+	static const t_span_kernel	flat[SIMD_LEVELS] = {flat_span_base,
+		flat_span_sse42, flat_span_avx2, flat_span_avx512};
+
+	k->nearest_row = nearest[k->level];
+	k->blend_rows = blend[k->level];
+	k->stretch_row = stretch[k->level];
+	k->flat_span = flat[k->level];
+}
+
+#else
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Other architectures only have the baseline kernels.                      */
+/*                                                                            */
+/* ************************************************************************** */
+int	detect_simd(void)
+{
+	return (SIMD_BASE);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Every level maps to the baseline kernels (`init_kernels` rejects any     */
+/*   level above SIMD_BASE here).                                             */
+/*                                                                            */
+/* ************************************************************************** */
+void	select_kernels(t_kernels *k)
+{
+	k->nearest_row = nearest_row_base;
+	k->blend_rows = blend_rows_base;
+	k->stretch_row = stretch_row_base;
+	k->flat_span = flat_span_base;
+}
+
+#endif
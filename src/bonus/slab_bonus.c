@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   slab_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:49:09 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Heights of a partial-height cell, in wall heights (the eye is at 0.5):   */
+/*     '4' low wall   floor part up to LOW_WALL_HEIGHT                        */
+/*     '5' step       floor part up to STEP_HEIGHT                            */
+/*     '6' window     floor part up to WINDOW_SILL, ceiling part from         */
+/*                    LINTEL_HEIGHT                                           */
+/*     '7' lintel     ceiling part from LINTEL_HEIGHT (walkable)              */
+/*                                                                            */
+/* ************************************************************************** */
+static void	block_heights(char tile, t_slab *s)
+{
+	s->floor = 0.0;
+	s->ceil = 1.0;
+	if (tile == '4')
+		s->floor = LOW_WALL_HEIGHT;
+	else if (tile == '5')
+		s->floor = STEP_HEIGHT;
+	else if (tile == '6')
+		s->floor = WINDOW_SILL;
+	if (tile == '6' || tile == '7')
+		s->ceil = LINTEL_HEIGHT;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Narrows the open span of the ray by the silhouette of a slab.            */
+/*                                                                            */
+/*   - Rows are kept as (y - horizon) / view height, where a height z seen    */
+/*     at distance d lands on (0.5 - z) / d. The horizon (view_z) cancels     */
+/*     out, so cached columns stay valid while the player looks up or down.   */
+/*   - The floor part hides everything below the higher of its top edges      */
+/*     (front face or far edge of its top), the ceiling part everything above */
+/*     the lower of its bottom edges.                                         */
+/*                                                                            */
+/* ************************************************************************** */
+static void	clip_ray(t_ray *ray, const t_slab *s)
+{
+	if (s->floor > 0.0)
+		ray->clip[1] = fmin(ray->clip[1], fmin((0.5 - s->floor) / s->near,
+					(0.5 - s->floor) / s->far));
+	if (s->ceil < 1.0)
+		ray->clip[0] = fmax(ray->clip[0], fmax((0.5 - s->ceil) / s->near,
+					(0.5 - s->ceil) / s->far));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Records the partial-height cell the DDA just entered.                    */
+/*                                                                            */
+/*   - near: distance of the crossed grid line (the front face),              */
+/*     far: distance of the next one, where the ray leaves the cell.          */
+/*   - The front face gets its texture, line height and light like a wall.    */
+/*   - Returns true once the slabs cover the whole column, so the DDA can     */
+/*     stop before reaching a wall. Past COLUMN_SLABS cells, further ones are */
+/*     not drawn and the ray runs on to the next wall.                        */
+/*                                                                            */
+/* ************************************************************************** */
+bool	add_slab(t_app *app, t_ray *ray)
+{
+	t_slab	*s;
+
+	if (ray->slabs == COLUMN_SLABS)
+		return (false);
+	s = &ray->slab[ray->slabs++];
+	block_heights(ray->hit_tile, s);
+	if (ray->side == 0)
+		s->near = ray->sidedist.x - ray->deltadist.x;
+	else
+		s->near = ray->sidedist.y - ray->deltadist.y;
+	s->far = fmin(ray->sidedist.x, ray->sidedist.y);
+	ray->perpwalldist = s->near;
+	compute_texture_params(app, ray, &s->draw);
+	s->draw.lh = (int)(app->view.h / s->near);
+	s->draw.light = light_at(&app->game.light,
+			app->cam.pos.x + ray->raydir.x * (s->near - 0.01),
+			app->cam.pos.y + ray->raydir.y * (s->near - 0.01));
+	clip_ray(ray, s);
+	return (ray->clip[0] >= ray->clip[1]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   View rows of render view column `x` left open at distance `depth`: the   */
+/*   open span stored behind the last slab in front of it when the column     */
+/*   was drawn, or the whole view.                                            */
+/*                                                                            */
+/* ************************************************************************** */
+void	open_rows(const t_app *app, int x, double depth, int *rows)
+{
+	const t_slab	*s;
+	int				i;
+
+	rows[0] = 0;
+	rows[1] = app->view.h;
+	s = &app->cache.slabs[x * COLUMN_SLABS];
+	i = -1;
+	while (++i < app->cache.cols[x].slabs && s[i].near < depth)
+	{
+		rows[0] = s[i].open[0];
+		rows[1] = s[i].open[1];
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Rows of window column `x` where a sprite at `depth` is not hidden.       */
+/*                                                                            */
+/*   - `x` is the render view column of the window column.                    */
+/*   - Nothing is visible behind the wall of the column (z-buffer test).      */
+/*   - Otherwise the rows left open by the slabs in front of the sprite       */
+/*     (`open_rows`) are scaled to window rows into d->clip.                  */
+/*   - The see-through walls in front of the sprite are counted, to be        */
+/*     tested pixel by pixel (`thin_hides`).                                  */
+/*   - Returns false if no row is visible.                                    */
+/*                                                                            */
+/* ************************************************************************** */
+bool	sprite_rows(const t_app *app, int x, double depth, t_draw_data *d)
+{
+	const t_thin	*w;
+
+	if (depth > app->z_buffer[x])
+		return (false);
+	open_rows(app, x, depth, d->clip);
+	d->clip[0] = d->clip[0] * app->cfg.height / app->view.h;
+	d->clip[1] = d->clip[1] * app->cfg.height / app->view.h;
+	d->vx = x;
+	d->thins = 0;
+	w = &app->cache.thins[x * COLUMN_THINS];
+	while (d->thins < app->cache.cols[x].thins && w[d->thins].dist < depth)
+		d->thins++;
+	return (d->clip[0] < d->clip[1]);
+}
@@ -0,0 +1,174 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   slab_draw_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:49:27 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns the view row where height `z` (in wall heights) is seen at       */
+/*   distance `dist`, clamped to [0, view.h]:                                 */
+/*       y = horizon + view.h * (0.5 - z) / dist                              */
+/*   Rows are rounded at pixel centers, so shared edges never overlap.        */
+/*                                                                            */
+/* ************************************************************************** */
+static int	row_of(const t_app *app, double z, double dist)
+{
+	double	y;
+
+	y = app->view.h / 2 - app->view.z + app->view.h * (0.5 - z) / dist;
+	if (y < 0.0)
+		return (0);
+	if (y > app->view.h)
+		return (app->view.h);
+	return ((int)ceil(y - 0.5));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Color of view row `y` of a slab's top (below the horizon) or underside   */
+/*   (above it).                                                              */
+/*                                                                            */
+/*   - Like the floor and ceiling passes but at the height of the surface:    */
+/*       dist = view.h * (0.5 - z) / (y + 0.5 - horizon)                      */
+/*   - Uses the floor or ceiling texture (flat_texel) when there is one,      */
+/*     else the precomputed flat color; shaded with the light of the face.    */
+/*                                                                            */
+/* ************************************************************************** */
+static uint32_t	cap_color(const t_app *app, int x, int y, const t_slab *s)
+{
+	const t_flat_tex	*t;
+	const uint32_t		*flat;
+	double				d;
+	int					row;
+
+	t = &app->game.floor_tex;
+	flat = app->shade.floor;
+	d = y + 0.5 - (app->view.h / 2 - app->view.z);
+	if (d < 0.0)
+	{
+		t = &app->game.ceil_tex;
+		flat = app->shade.ceiling;
+		d = app->view.h * (0.5 - s->ceil) / d;
+	}
+	else
+		d = app->view.h * (0.5 - s->floor) / d;
+	row = shade_row(shade_level(d), s->draw.light);
+	if (!t->px)
+		return (flat[row]);
+	return (shade_pixel(app->shade.lut[row], flat_texel(t,
+				app->cam.pos.x + d * app->rays.dir[x].x,
+				app->cam.pos.y + d * app->rays.dir[x].y)));
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws rows [r[0], r[1]) of column `x`, clipped to the open span of the   */
+/*   slab: the front face if r[2] == 0 (same path as walls, `draw_pixels`),   */
+/*   else its top or underside.                                               */
+/*                                                                            */
+/* ************************************************************************** */
+static void	draw_rows(t_app *app, int x, t_slab *s, int *r)
+{
+	uint32_t	*px;
+
+	if (r[0] < s->open[0])
+		r[0] = s->open[0];
+	if (r[1] > s->open[1])
+		r[1] = s->open[1];
+	if (r[0] >= r[1])
+		return ;
+	if (r[2] == 0)
+	{
+		s->draw.ds = r[0];
+		s->draw.de = r[1];
+		draw_pixels(app, x, &s->draw, s->near);
+		return ;
+	}
+	px = (uint32_t *)app->scene->pixels + x;
+	r[0]--;
+	while (++r[0] < r[1])
+		px[r[0] * app->scene->width] = cap_color(app, x, r[0], s);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws the floor part (`ceil` false) or the ceiling part of a slab, then  */
+/*   narrows its open span.                                                   */
+/*                                                                            */
+/*   - e[0], e[1]: inner edge (top of the floor part, bottom of the ceiling   */
+/*     part) at the front face and at the far side of the cell.               */
+/*   - e[2]: outer edge of the front face (floor or ceiling line).            */
+/*   - The face spans e[0]..e[2]. The top of a floor part shows between e[1]  */
+/*     and e[0] when it is below the eye, the underside of a ceiling part     */
+/*     between e[0] and e[1] when it is above.                                */
+/*                                                                            */
+/* ************************************************************************** */
+static void	draw_part(t_app *app, int x, t_slab *s, bool ceil)
+{
+	double	z;
+	int		e[3];
+
+	z = s->floor;
+	if (ceil)
+		z = s->ceil;
+	e[0] = row_of(app, z, s->near);
+	e[1] = row_of(app, z, s->far);
+	e[2] = row_of(app, 0.0, s->near);
+	if (ceil)
+		e[2] = row_of(app, 1.0, s->near);
+	if (!ceil)
+		draw_rows(app, x, s, (int [3]){e[0], e[2], 0});
+	else
+		draw_rows(app, x, s, (int [3]){e[2], e[0], 0});
+	if (!ceil && e[1] < e[0])
+		draw_rows(app, x, s, (int [3]){e[1], e[0], 1});
+	else if (ceil && e[0] < e[1])
+		draw_rows(app, x, s, (int [3]){e[0], e[1], 1});
+	if (!ceil && fmin(e[0], e[1]) < s->open[1])
+		s->open[1] = fmin(e[0], e[1]);
+	if (ceil && fmax(e[0], e[1]) > s->open[0])
+		s->open[0] = fmax(e[0], e[1]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws the partial-height cells of column `x`, front to back.             */
+/*                                                                            */
+/*   - `open` is the span of view rows nothing has been drawn on yet. Each    */
+/*     slab only draws inside it and then narrows it by its silhouette, so    */
+/*     every pixel of the column is written by one surface only.              */
+/*   - Each slab keeps the span left behind it, for sprites and see-through   */
+/*     walls (`open_rows`).                                                   */
+/*   - On return `open` is what is left for the wall behind the slabs.        */
+/*                                                                            */
+/* ************************************************************************** */
+void	draw_slabs(t_app *app, int x, int *open)
+{
+	t_slab	*s;
+	int		i;
+
+	open[0] = 0;
+	open[1] = app->view.h;
+	i = -1;
+	while (++i < app->cache.cols[x].slabs)
+	{
+		s = &app->cache.slabs[x * COLUMN_SLABS + i];
+		s->open[0] = open[0];
+		s->open[1] = open[1];
+		if (s->floor > 0.0)
+			draw_part(app, x, s, false);
+		if (s->ceil < 1.0)
+			draw_part(app, x, s, true);
+		open[0] = s->open[0];
+		open[1] = s->open[1];
+	}
+}
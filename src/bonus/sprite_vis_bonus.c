@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sprite_vis_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:13:20 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 17:16:34 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   One FNV-1a step of the sprite signature.                                 */
+/*                                                                            */
+/* ************************************************************************** */
+static uint64_t	mix(uint64_t h, uint64_t v)
+{
+	return ((h ^ v) * 1099511628211ULL);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Returns true if some pixel of enemy `e` would be drawn this frame.       */
+/*                                                                            */
+/*   - Same projection as `render_enemy`: the enemy must be in front of the   */
+/*     camera, and one of the window columns of its sprite must be on screen  */
+/*     and leave rows open in front of it (`sprite_rows`).                    */
+/*                                                                            */
+/* ************************************************************************** */
+static bool	on_screen(const t_app *a, const t_enemy *e)
+{
+	t_draw_data	d;
+	t_vec2		t;
+	int			half;
+	int			x;
+	int			end;
+
+	t = to_camera_space(a, (t_vec2){e->pos_x - a->cam.pos.x,
+			e->pos_y - a->cam.pos.y});
+	if (t.y <= 0)
+		return (false);
+	x = (int)((a->cfg.width / 2) * (1 + t.x / t.y));
+	half = abs((int)(a->cfg.height / t.y)) / 2;
+	end = x + half;
+	if (end > a->cfg.width)
+		end = a->cfg.width;
+	x = x - half - 1;
+	if (x < -1)
+		x = -1;
+	while (++x < end)
+		if (sprite_rows(a, x * a->view.w / a->cfg.width, t.y, &d))
+			return (true);
+	return (false);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Collects the enemies drawn this frame into `out` and returns how many.   */
+/*                                                                            */
+/*   - Only active enemies that are actually on screen are kept, so enemies   */
+/*     behind the camera or a wall never make the world layer dirty.          */
+/*   - `sig` hashes what the kept sprites look like: index, position, clip    */
+/*     frame, facing side and hit flash. The world layer is redrawn when it   */
+/*     differs from the last frame's (`update_layers`), which covers sprites  */
+/*     that change, appear or disappear.                                      */
+/*                                                                            */
+/* ************************************************************************** */
+int	visible_sprites(const t_app *a, t_enemy **out, uint64_t *sig)
+{
+	uint64_t	bits[2];
+	t_enemy		*e;
+	int			n;
+	int			i;
+
+	*sig = 1469598103934665603ULL;
+	n = 0;
+	i = -1;
+	while (++i < a->game.enemy_count)
+	{
+		e = &a->game.enemies[i];
+		if (!e->is_active || !on_screen(a, e))
+			continue ;
+		out[n++] = e;
+		ft_memcpy(&bits[0], &e->pos_x, sizeof(double));
+		ft_memcpy(&bits[1], &e->pos_y, sizeof(double));
+		*sig = mix(mix(mix(*sig, i), bits[0]), bits[1]);
+		*sig = mix(mix(mix(mix(*sig, e->e_state), e->anim_frame), e->e_dir),
+				e->hit_flash > 0);
+	}
+	return (n);
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/18 14:27:08 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:29:40 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:41:55 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,7 +18,7 @@
 /*                                                                            */
 /*   - Checks if each texture exists before calling `mlx_delete_texture()`.   */
 /*   - Handles wall textures (NO, SO, WE, EA), door textures, enemy texture,  */
-/*     and weapon texture.                                                    */
+/*     weapon texture and thin wall texture.                                  */
 /*                                                                            */
 /* ************************************************************************** */
 static void	free_mlx_textures(t_app *app)
@@ -39,6 +39,8 @@ static void	free_mlx_textures(t_app *app)
 		mlx_delete_texture(app->game.tex_enemy);
 	if (app->game.tex_weapon)
 		mlx_delete_texture(app->game.tex_weapon);
+	if (app->game.tex_thin)
+		mlx_delete_texture(app->game.tex_thin);
 }
 
 /* ************************************************************************** */
@@ -46,25 +48,14 @@ static void	free_mlx_textures(t_app *app)
 /*   Safely frees all allocated memory and textures in the game.              */
 /*                                                                            */
 /*   - Frees loaded MLX textures.                                             */
-/*   - Frees texture path strings.                                            */
-/*   - Frees dynamic arrays for doors and enemies if they exist.              */
+/*   - Releases the level arena in one shot: map rows, texture paths, doors   */
+/*     and enemies all live in it.                                            */
 /*                                                                            */
 /* ************************************************************************** */
 void	safe_free(t_app *app)
 {
 	free_mlx_textures(app);
-	free(app->game.texture_no);
-	free(app->game.texture_so);
-	free(app->game.texture_we);
-	free(app->game.texture_ea);
-	free(app->game.texture_door);
-	free(app->game.texture_door_w);
-	free(app->game.texture_enemy);
-	free(app->game.texture_weapon);
-	if (app->game.doors)
-		free(app->game.doors);
-	if (app->game.enemies)
-		free(app->game.enemies);
+	arena_free(&app->game.arena);
 }
 
 /* ************************************************************************** */
@@ -101,7 +92,8 @@ static int	load_main_textures(t_app *app)
 /*    - If enemy texture exists, load it. If fails, print error and cleanup.  */
 /*    - If door textures exist, load both door types (normal and wall).       */
 /*    - Ensure both door textures are loaded if one is present (consistency). */
-/*    - If weapon texture exists, load it and set it to the weapon struct.    */
+/*    - If weapon texture exists, load it, set it to the weapon struct and    */
+/*      pre-scale its animation frames.                                       */
 /*                                                                            */
 /* ************************************************************************** */
 static int	load_extra_textures(t_app *app)
@@ -127,6 +119,8 @@ static int	load_extra_textures(t_app *app)
 		if (!g->tex_weapon)
 			return (printf("Error\n Weapon txt \n"), cleanup(app), -1);
 		app->weapon.texture = g->tex_weapon;
+		if (build_weapon_cache(app) == -1)
+			return (printf("Error\n Weapon cache\n"), cleanup(app), -1);
 	}
 	return (0);
 }
@@ -140,6 +134,8 @@ static int	load_extra_textures(t_app *app)
 /*      If missing, print error and terminate MLX immediately.                */
 /*    - Load main wall textures.                                              */
 /*    - Load extra textures (enemies, doors, weapons).                        */
+/*    - Load the optional floor and ceiling textures, and the thin wall       */
+/*      texture with its alpha mask.                                          */
 /*    - If any loading fails, cleanup and return error.                       */
 /*                                                                            */
 /* ************************************************************************** */
@@ -154,7 +150,9 @@ int	load_game_textures(t_app *app)
 		mlx_terminate(app->mlx);
 		return (-1);
 	}
-	if (load_main_textures(app) == -1 || load_extra_textures(app) == -1)
+	if (load_main_textures(app) == -1 || load_extra_textures(app) == -1
+		|| load_flat_textures(app) == -1 || load_thin_texture(app) == -1
+		|| build_enemy_anim(app) == -1)
 		return (-1);
 	return (0);
 }
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thin_draw_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:59:45 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws one opaque run of texture rows [run[0], run[1]) of a see-through   */
+/*   wall in column `x`.                                                      */
+/*                                                                            */
+/*   - The run is mapped back to view rows, widened by a row on each side     */
+/*     and clipped to the rows of the wall (`ds`, `de`).                      */
+/*   - Each row computes `ty` like `draw_pixels` and is drawn only if it      */
+/*     falls inside the run, so every texel written is opaque without its     */
+/*     alpha being read:                                                      */
+/*       y = ty * lh / texture_height + view.h / 2 - lh / 2 - view.z          */
+/*                                                                            */
+/* ************************************************************************** */
+static void	draw_run(t_app *app, int x, const t_thin *w, const int *run)
+{
+	const uint8_t	*lut;
+	uint8_t			*p;
+	uint32_t		px;
+	int				y[3];
+	double			k[2];
+
+	lut = app->shade.lut[shade_row(shade_level(w->dist), w->draw.light)];
+	k[0] = w->draw.lh / (double)w->draw.tex->height;
+	k[1] = (app->view.h - w->draw.lh) / 2.0 - app->view.z;
+	y[0] = fmax(floor(run[0] * k[0] + k[1]) - 2, w->draw.ds - 1);
+	y[1] = fmin(ceil(run[1] * k[0] + k[1]) + 1, w->draw.de);
+	while (++y[0] < y[1])
+	{
+		y[2] = (y[0] + app->view.z) * 256 - app->view.h * 128
+			+ w->draw.lh * 128;
+		y[2] = ((y[2] * (int)w->draw.tex->height) / w->draw.lh) >> 8;
+		if (y[2] < run[0] || y[2] >= run[1])
+			continue ;
+		px = ((uint32_t *)w->draw.tex->pixels)
+		[y[2] * w->draw.tex->width + w->draw.tx];
+		p = app->scene->pixels + (y[0] * app->scene->width + x) * 4;
+		p[0] = lut[px & 0xFF];
+		p[1] = lut[(px >> 8) & 0xFF];
+		p[2] = lut[(px >> 16) & 0xFF];
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws a see-through wall in column `x`.                                  */
+/*                                                                            */
+/*   - Its rows are those of a wall at its distance, clipped to the rows the  */
+/*     slabs in front of it left open (`open_rows`), and kept in the cache    */
+/*     for sprites (`thin_hides`).                                            */
+/*   - Only the opaque runs of its texture column are visited (`thin_mask`),  */
+/*     so transparent texels cost nothing.                                    */
+/*                                                                            */
+/* ************************************************************************** */
+static void	draw_thin(t_app *app, int x, t_thin *w)
+{
+	const t_mask	*m;
+	int				open[2];
+	int				i;
+
+	open_rows(app, x, w->dist, open);
+	w->draw.ds = -w->draw.lh / 2 + app->view.h / 2 - app->view.z;
+	if (w->draw.ds < open[0])
+		w->draw.ds = open[0];
+	w->draw.de = w->draw.lh / 2 + app->view.h / 2 - app->view.z;
+	if (w->draw.de > open[1])
+		w->draw.de = open[1];
+	if (w->draw.ds >= w->draw.de)
+		return ;
+	m = &app->game.thin_mask;
+	i = m->col[w->draw.tx] - 1;
+	while (++i < m->col[w->draw.tx + 1])
+		draw_run(app, x, w, m->run + 2 * i);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Draws the see-through walls of column `x` over the wall and slabs        */
+/*   behind them, back to front, so nearer ones cover farther ones.           */
+/*                                                                            */
+/* ************************************************************************** */
+void	draw_thins(t_app *app, int x)
+{
+	int	i;
+
+	i = app->cache.cols[x].thins;
+	while (--i >= 0)
+		draw_thin(app, x, &app->cache.thins[x * COLUMN_THINS + i]);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Tells whether window row `y` of a sprite stripe is covered by an opaque  */
+/*   texel of a see-through wall in front of the sprite.                      */
+/*                                                                            */
+/*   - d->vx is the render view column of the stripe, d->thins the number of  */
+/*     its walls nearer than the sprite (see `sprite_rows`).                  */
+/*   - The row is scaled to the render view and tested against the rows each  */
+/*     wall was drawn on, then against the alpha of its texel.                */
+/*                                                                            */
+/* ************************************************************************** */
+bool	thin_hides(const t_app *app, const t_draw_data *d, int y)
+{
+	const t_thin		*w;
+	const mlx_texture_t	*t;
+	int					ty;
+	int					i;
+
+	y = y * app->view.h / app->cfg.height;
+	w = &app->cache.thins[d->vx * COLUMN_THINS];
+	i = -1;
+	while (++i < d->thins)
+	{
+		if (y < w[i].draw.ds || y >= w[i].draw.de)
+			continue ;
+		t = w[i].draw.tex;
+		ty = (y + app->view.z) * 256 - app->view.h * 128 + w[i].draw.lh * 128;
+		ty = ((ty * (int)t->height) / w[i].draw.lh) >> 8;
+		if (ty >= 0 && ty < (int)t->height && (((uint32_t *)t->pixels)
+			[ty * t->width + w[i].draw.tx] >> 24) >= MASK_ALPHA)
+			return (true);
+	}
+	return (false);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thin_wall_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:58:58 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:08:30 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Finds the opaque runs of texture column `x`: texels whose alpha is at    */
+/*   least MASK_ALPHA, as [start, end) pairs of rows.                         */
+/*                                                                            */
+/*   - Writes them to `run` unless it is NULL (counting pass).                */
+/*   - Returns the number of runs.                                            */
+/*                                                                            */
+/* ************************************************************************** */
+static int	mask_runs(const mlx_texture_t *t, int x, int *run)
+{
+	const uint32_t	*px;
+	int				y;
+	int				n;
+	bool			in;
+	bool			opaque;
+
+	px = (const uint32_t *)t->pixels + x;
+	n = 0;
+	in = false;
+	y = -1;
+	while (++y <= (int)t->height)
+	{
+		opaque = y < (int)t->height && (px[y * t->width] >> 24) >= MASK_ALPHA;
+		if (opaque && !in && run)
+			run[2 * n] = y;
+		if (!opaque && in)
+		{
+			if (run)
+				run[2 * n + 1] = y;
+			n++;
+		}
+		in = opaque;
+	}
+	return (n);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Builds the alpha mask of the thin wall texture in the level arena.       */
+/*                                                                            */
+/*   - A first pass counts the runs, a second one stores them; the runs of    */
+/*     column x are run[2 * col[x]] to run[2 * col[x + 1]].                   */
+/*   - The mask is `opaque` when every column is a single run covering the    */
+/*     whole height: thin walls are then drawn and hit like walls.            */
+/*                                                                            */
+/* ************************************************************************** */
+static int	build_mask(t_game *g, const mlx_texture_t *t)
+{
+	t_mask	*m;
+	int		x;
+	int		n;
+
+	m = &g->thin_mask;
+	n = 0;
+	x = -1;
+	while (++x < (int)t->width)
+		n += mask_runs(t, x, NULL);
+	m->col = arena_alloc(&g->arena, (t->width + 1) * sizeof(int));
+	m->run = arena_alloc(&g->arena, (2 * n + 1) * sizeof(int));
+	if (!m->col || !m->run)
+		return (-1);
+	m->col[0] = 0;
+	x = -1;
+	while (++x < (int)t->width)
+	{
+		m->col[x + 1] = m->col[x] + mask_runs(t, x, m->run + 2 * m->col[x]);
+		if (m->col[x + 1] != m->col[x] + 1 || m->run[2 * m->col[x]] != 0
+			|| m->run[2 * m->col[x] + 1] != (int)t->height)
+			m->opaque = false;
+	}
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Loads the optional thin wall texture (GR) and builds its alpha mask.     */
+/*                                                                            */
+/*   - Without one, thin walls use the wall textures and are opaque.          */
+/*   - If loading fails, prints error, calls cleanup, returns -1.             */
+/*                                                                            */
+/* ************************************************************************** */
+int	load_thin_texture(t_app *app)
+{
+	t_game	*g;
+
+	g = &app->game;
+	g->thin_mask.opaque = true;
+	if (!g->texture_thin)
+		return (0);
+	g->tex_thin = mlx_load_png(g->texture_thin);
+	if (!g->tex_thin)
+		return (printf("Error\nThin wall texture\n"), cleanup(app), -1);
+	if (build_mask(g, g->tex_thin) == -1)
+		return (printf("Error\nOut of memory\n"), cleanup(app), -1);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Handles a thin wall cell entered by the DDA.                             */
+/*                                                                            */
+/*   - The wall stands in the middle of the cell: x = map_x + 0.5 for '8'     */
+/*     (a wall along y), y = map_y + 0.5 for '9' (along x). If the ray        */
+/*     leaves the cell before crossing it (`mid_plane`), it goes on.          */
+/*   - An opaque thin wall (or any thin wall for rays that do not collect     */
+/*     them) stops the ray like a wall: the hit distance and side are set     */
+/*     here, so `do_dda` keeps them.                                          */
+/*   - A see-through one is recorded with its texture column, line height     */
+/*     and light, and the ray goes on to what lies behind it. Past            */
+/*     COLUMN_THINS walls, further ones are not drawn.                        */
+/*   - Returns true if the ray stops.                                         */
+/*                                                                            */
+/* ************************************************************************** */
+bool	add_thin(t_app *app, t_ray *ray)
+{
+	t_thin	*w;
+	double	t;
+
+	if (!mid_plane(ray, ray->hit_tile == '9', &t))
+		return (false);
+	ray->side = (ray->hit_tile == '9');
+	ray->perpwalldist = t;
+	if (!ray->thin || app->game.thin_mask.opaque)
+		return (true);
+	if (ray->thins == COLUMN_THINS)
+		return (false);
+	w = &ray->thin[ray->thins++];
+	w->dist = t;
+	compute_texture_params(app, ray, &w->draw);
+	w->draw.lh = (int)(app->view.h / t);
+	w->draw.light = light_at(&app->game.light,
+			app->cam.pos.x + ray->raydir.x * (t - 0.01),
+			app->cam.pos.y + ray->raydir.y * (t - 0.01));
+	return (false);
+}
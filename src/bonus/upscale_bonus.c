@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   upscale_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:35:35 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:59:21 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Nearest-neighbour upscale of the world layer into the window image.      */
+/*                                                                            */
+/*   - Source pixel = (fixed + 128) >> 8, i.e. the rounded table coordinate.  */
+/*   - Consecutive window rows reading the same view row are copied from the  */
+/*     row just written instead of being resampled.                           */
+/*   - Rows are resampled by the CPU-dispatched `nearest_row` kernel.         */
+/*                                                                            */
+/* ************************************************************************** */
+static void	upscale_nearest(t_app *app)
+{
+	uint32_t	*dst;
+	uint32_t	*src;
+	int			y;
+
+	dst = (uint32_t *)app->image->pixels;
+	y = -1;
+	while (++y < app->cfg.height)
+	{
+		if (y > 0 && (app->view.fy[y] + 128) >> 8
+			== (app->view.fy[y - 1] + 128) >> 8)
+		{
+			ft_memcpy(dst, dst - app->cfg.width,
+				app->cfg.width * sizeof(uint32_t));
+			dst += app->cfg.width;
+			continue ;
+		}
+		src = (uint32_t *)app->scene->pixels
+			+ ((app->view.fy[y] + 128) >> 8) * app->view.w;
+		app->kernels.nearest_row((t_row_job){.dst = dst, .r0 = src,
+			.fx = app->view.fx, .w = app->cfg.width});
+		dst += app->cfg.width;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Bilinear upscale of one window row, in two CPU-dispatched passes.        */
+/*                                                                            */
+/*   - r0/r1 are the two view rows around the sample, clamped at the bottom.  */
+/*   - `blend_rows` mixes them with the Y weight into `tmp` (one view row),   */
+/*     then `stretch_row` resamples `tmp` with the X weights.                 */
+/*                                                                            */
+/* ************************************************************************** */
+static void	upscale_bilinear_row(t_app *app, uint32_t *dst, int y,
+		uint32_t *tmp)
+{
+	uint32_t	*r0;
+	uint32_t	*r1;
+
+	r0 = (uint32_t *)app->scene->pixels + (app->view.fy[y] >> 8) * app->view.w;
+	r1 = r0;
+	if ((app->view.fy[y] >> 8) < app->view.h - 1)
+		r1 = r0 + app->view.w;
+	app->kernels.blend_rows((t_row_job){.dst = tmp, .r0 = r0, .r1 = r1,
+		.w = app->view.w, .f = app->view.fy[y] & 0xFF});
+	app->kernels.stretch_row((t_row_job){.dst = dst, .r0 = tmp,
+		.fx = app->view.fx, .w = app->cfg.width, .last = app->view.w - 1});
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Copies the world layer into the window image.                            */
+/*                                                                            */
+/*   - At 100% scale this is a plain copy; otherwise the view is upscaled     */
+/*     with the nearest or bilinear filter (`view.bilinear`). The bilinear    */
+/*     filter takes its intermediate row from the frame arena.                */
+/*   - Dynamic passes (minimap, enemies, weapon, hit feedback) are drawn on   */
+/*     the window image afterwards, at window resolution, so the world layer  */
+/*     stays clean and can be reused by the next frame.                       */
+/*                                                                            */
+/* ************************************************************************** */
+void	present_scene(t_app *app)
+{
+	uint32_t	*tmp;
+	int			y;
+
+	if (app->view.scale == 100)
+	{
+		ft_memcpy(app->image->pixels, app->scene->pixels,
+			(size_t)app->cfg.width * app->cfg.height * sizeof(uint32_t));
+		return ;
+	}
+	if (!app->view.bilinear)
+	{
+		upscale_nearest(app);
+		return ;
+	}
+	tmp = arena_alloc(&app->frame, app->view.w * sizeof(uint32_t));
+	if (!tmp)
+		return ;
+	y = -1;
+	while (++y < app->cfg.height)
+		upscale_bilinear_row(app,
+			(uint32_t *)app->image->pixels + y * app->cfg.width, y, tmp);
+}
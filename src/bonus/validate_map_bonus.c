@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/28 21:58:25 by victor            #+#    #+#             */
-/*   Updated: 2025/04/24 20:42:46 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,8 +18,8 @@
 /*                                                                            */
 /*   - Iterates over the map lines from the bottom.                           */
 /*   - Trims the line to remove spaces and checks if the line is empty.      */
-/*   - If the line is empty, it frees the memory of the line and decreases    */
-/*     the map height.                                                       */
+/*   - If the line is empty, it drops the line (its memory belongs to the     */
+/*     level arena) and decreases the map height.                            */
 /*   - Stops when a non-empty line is encountered or the whole map is empty. */
 /*                                                                            */
 /* ************************************************************************** */
@@ -32,7 +32,6 @@ static void	check_empty_line(t_game *game)
 		trimmed = ft_strtrim(game->map[game->map_height - 1], " ");
 		if (ft_strlen(trimmed) == 0)
 		{
-			free(game->map[game->map_height - 1]);
 			game->map[game->map_height - 1] = NULL;
 			game->map_height--;
 		}
@@ -97,13 +96,15 @@ static void	validate_borders(char *line, int is_border)
 /*     - West ('W') has direction (-1, 0) and plane (0, -0.66).              */
 /*   - The camera's direction vector defines which way it faces.             */
 /*   - The plane vector helps in calculating the view direction for the ray. */
+/*   - The plane is sized for DEF_FOV; `init_render_config` resizes it to     */
+/*     the configured FOV once the settings are applied.                      */
 //*    double	fov; fov = 60 * (M_PI / 180);// dir * tan(FOV/2), dir = 1    */
 /* ************************************************************************** */
 static void	set_camera(t_camera *camera, char dir, int x, int y)
 {
 	double	plane;
 
-	plane = tan(86 * (M_PI / 180) / 2);
+	plane = tan(DEF_FOV * (M_PI / 180) / 2);
 	camera->pos.x = x + 0.5;
 	camera->pos.y = y + 0.5;
 	if (dir == 'N')
@@ -133,7 +134,9 @@ static void	set_camera(t_camera *camera, char dir, int x, int y)
 /*   Processes each character in a row of the map.                            */
 /*                                                                            */
 /*   - For each row, checks whether each character is valid                   */
-/*     (' ', '0', '1', 'N', 'S', 'E', 'W').                                   */
+/*     (' ', '0', '1', 'N', 'S', 'E', 'W', doors '2'/'3', enemies 'B',        */
+/*     lamps 'L', which stay in the map until the light map is baked, and     */
+/*     the partial-height cells '4' to '7' and thin walls '8'/'9').           */
 /*   - If a spawn character ('N', 'S', 'E', or 'W') is found, the camera's    */
 /*     position and direction are set accordingly.                            */
 /*   - Replaces the spawn character with '0' to mark the cell as empty.       */
@@ -149,7 +152,7 @@ static void	process_row_chars(t_game *g, t_camera *cam, int i, int *count)
 	while (g->map[i][++j])
 	{
 		c = g->map[i][j];
-		if (!ft_strchr(" 01NSEW23B", c))
+		if (!ft_strchr(" 01NSEW23BL456789", c))
 			exit(write(2, "Error\nInvalid character in map\n", 31));
 		if (ft_strchr("NSEW", c))
 		{
@@ -169,6 +172,7 @@ static void	process_row_chars(t_game *g, t_camera *cam, int i, int *count)
 /*   Validates the map by checking for empty lines, borders, and spawn.       */
 /*                                                                            */
 /*   - Calls `check_empty_line()` to remove empty lines at the bottom.        */
+/*   - Sizes the doors and enemies arrays with `reserve_entities()`.          */
 /*   - Ensures that the map borders are closed and valid `validate_borders()` */
 /*   - Processes each row for valid characters and checks for exact one spawn */
 /*   - Exits with an error if any conditions are violated.                    */
@@ -180,6 +184,7 @@ void	validate_map(t_game *game, t_camera *camera)
 	int		spawn_count;
 
 	check_empty_line(game);
+	reserve_entities(game);
 	spawn_count = 0;
 	camera->view_z = 0;
 	i = -1;
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   view_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:35:35 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 16:03:12 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Converts a source coordinate to 8.8 fixed point, clamped to the valid    */
+/*   pixel range [0, size - 1] so the upscaler never reads outside the view.  */
+/*                                                                            */
+/* ************************************************************************** */
+static int	to_fixed(double src, int size)
+{
+	int	f;
+
+	f = (int)(src * 256.0);
+	if (f < 0)
+		f = 0;
+	if (f > (size - 1) * 256)
+		f = (size - 1) * 256;
+	return (f);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Builds the window -> view lookup tables used by the upscaler.            */
+/*                                                                            */
+/*   - Pixel centers are mapped, so each window pixel samples the view at:    */
+/*       src = (i + 0.5) * view_size / window_size - 0.5                      */
+/*   - Integer part selects the source pixel, the low 8 bits are the          */
+/*     bilinear weight. At 100% scale the mapping is the identity.            */
+/*                                                                            */
+/* ************************************************************************** */
+static void	build_upscale_tables(t_view *v, const t_config *c)
+{
+	int	i;
+
+	i = -1;
+	while (++i < c->width)
+		v->fx[i] = to_fixed((i + 0.5) * v->w / c->width - 0.5, v->w);
+	i = -1;
+	while (++i < c->height)
+		v->fy[i] = to_fixed((i + 0.5) * v->h / c->height - 0.5, v->h);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Sets the internal render resolution to `scale` percent of the window.    */
+/*                                                                            */
+/*   - Resizes the off-screen world layer (`scene`) to the new size.          */
+/*   - Invalidates the render cache: every cached column belongs to the old   */
+/*     resolution.                                                            */
+/*   - Rebuilds the upscale tables and starts a cooldown so the controller    */
+/*     measures a few frames at the new size before deciding again.           */
+/*   - Returns -1 if the image could not be resized, 0 otherwise.             */
+/*                                                                            */
+/* ************************************************************************** */
+int	set_view_scale(t_app *app, int scale)
+{
+	int	w;
+	int	h;
+
+	w = app->cfg.width * scale / 100;
+	h = app->cfg.height * scale / 100;
+	if (!mlx_resize_image(app->scene, w, h))
+		return (-1);
+	app->view.w = w;
+	app->view.h = h;
+	app->view.scale = scale;
+	app->view.cooldown = 15;
+	app->view.frame_ms = 0.0;
+	app->cache.valid = false;
+	build_upscale_tables(&app->view, &app->cfg);
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Frame-time controller for the render resolution.                         */
+/*                                                                            */
+/*   - Fed with the cost of frames that retraced the whole view, so cached    */
+/*     frames do not make the controller believe there is spare time.         */
+/*   - frame_ms is smoothed with an exponential moving average:               */
+/*       ema = ema + (sample - ema) * 0.2                                     */
+/*   - Above 110% of TARGET_FRAME_MS the scale drops one VIEW_SCALE_STEP,     */
+/*     below 60% it grows one step. The gap is wider than the cost ratio of   */
+/*     one step (pixels grow with scale²), so the scale does not oscillate.   */
+/*                                                                            */
+/* ************************************************************************** */
+void	update_view_scale(t_app *app, double frame_ms)
+{
+	t_view	*v;
+	int		scale;
+
+	v = &app->view;
+	if (v->frame_ms == 0.0)
+		v->frame_ms = frame_ms;
+	v->frame_ms += (frame_ms - v->frame_ms) * 0.2;
+	if (v->cooldown > 0)
+	{
+		v->cooldown--;
+		return ;
+	}
+	scale = v->scale;
+	if (v->frame_ms > TARGET_FRAME_MS * 1.1)
+		scale -= VIEW_SCALE_STEP;
+	else if (v->frame_ms < TARGET_FRAME_MS * 0.6)
+		scale += VIEW_SCALE_STEP;
+	if (scale < VIEW_MIN_SCALE)
+		scale = VIEW_MIN_SCALE;
+	if (scale > 100)
+		scale = 100;
+	if (scale != v->scale)
+		set_view_scale(app, scale);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Applies the configuration to the application before MLX starts.          */
+/*                                                                            */
+/*   - Sets the camera plane for the configured FOV, perpendicular to the     */
+/*     spawn direction: plane = rot90(dir) * tan(fov / 2).                    */
+/*   - Allocates the per-column and per-row render buffers once, at window    */
+/*     size (the render view never exceeds the window).                       */
+/*   - Returns -1 on allocation failure.                                      */
+/*                                                                            */
+/* ************************************************************************** */
+int	init_render_config(t_app *app, const t_config *cfg)
+{
+	double	len;
+
+	app->cfg = *cfg;
+	len = tan(cfg->fov * (M_PI / 180) / 2);
+	app->cam.plane = (t_vec2){-app->cam.dir.y * len, app->cam.dir.x * len};
+	app->z_buffer = ft_calloc(cfg->width, sizeof(double));
+	app->cache.cols = ft_calloc(cfg->width, sizeof(t_column));
+	app->cache.reproj = ft_calloc(cfg->width, sizeof(t_column));
+	app->cache.slabs = ft_calloc(cfg->width * COLUMN_SLABS, sizeof(t_slab));
+	app->cache.thins = ft_calloc(cfg->width * COLUMN_THINS, sizeof(t_thin));
+	app->bg.sx = ft_calloc(cfg->width, sizeof(double));
+	app->bg.cy = ft_calloc(cfg->height, sizeof(double));
+	app->bg.shade = ft_calloc(cfg->width, sizeof(uint8_t));
+	app->view.fx = ft_calloc(cfg->width, sizeof(int));
+	app->view.fy = ft_calloc(cfg->height, sizeof(int));
+	if (!app->z_buffer || !app->cache.cols || !app->cache.reproj
+		|| !app->cache.slabs || !app->cache.thins || !app->bg.sx || !app->bg.cy
+		|| !app->bg.shade || !app->view.fx || !app->view.fy
+		|| init_ray_table(&app->rays, cfg->width) == -1)
+		return (printf("Error: Failed to allocate render buffers\n"), -1);
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/25 21:47:45 by victor            #+#    #+#             */
-/*   Updated: 2025/04/26 13:17:08 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 14:17:40 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -34,118 +34,96 @@ void	weapon_initialize(t_weapon *w, bool *inited)
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Initializes drawing data for the weapon texture rendering.               */
+/*   Pre-scales every spritesheet frame of the weapon for the window size.    */
 /*                                                                            */
-/*   - Computes the rendered width and height based on the weapon's texture.  */
-/*   - Calculates the offsets for centering the weapon on the screen.         */
-/*   - Calculates texture sub-region dimensions and starting coordinates for  */
-/*     animation frames.                                                      */
+/*   - The weapon's on-screen size only depends on the window, so the         */
+/*     scaling and the transparency test are paid once at load time.          */
+/*   - Returns -1 if a frame cannot be allocated, 0 on success.               */
 /*                                                                            */
 /* ************************************************************************** */
-static void	init_draw_data(t_app *app, t_draw_data *d)
+int	build_weapon_cache(t_app *app)
 {
-	t_weapon	*w;
-	int			rendered_h;
-	int			rendered_w;
+	int	i;
 
-	w = &app->weapon;
-	rendered_h = HEIGHT * SCALE;
-	rendered_w = (w->texture->width * rendered_h)
-		/ w->texture->height;
-	d->sprite_height = rendered_h;
-	d->sprite_width = rendered_w;
-	d->offset_x = WIDTH / 2 - rendered_w / 2;
-	d->offset_y = HEIGHT - rendered_h + Y_OFFSET;
-	d->tex_width = w->texture->width;
-	d->tex_height = w->texture->height;
-	d->width = w->texture->width / COLS;
-	d->hgt = w->texture->height / ROWS;
-	d->st_x = (w->current_frame % COLS) * d->width;
-	d->st_y = (w->current_frame / COLS) * d->hgt;
+	if (!app->weapon.texture)
+		return (0);
+	i = 0;
+	while (i < COLS * ROWS)
+	{
+		if (build_weapon_frame(app, i, &app->weapon.frames[i]) == -1)
+			return (-1);
+		i++;
+	}
+	return (0);
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Draws a single pixel of the weapon texture onto the screen.              */
-/*                                                                            */
-/*   - Uses the pixel data from the weapon texture to select the color.       */
-/*   - Converts the texture's pixel color to the screen's color format.       */
-/*   - Only draws non-transparent pixels (alpha value is non-zero).           */
-/*   - Places the pixel at the correct position on the screen based on the    */
-/*     calculated offsets.                                                    */
+/*   Frees the pre-scaled weapon frames.                                      */
 /*                                                                            */
 /* ************************************************************************** */
-static void	draw_weapon_pixel(t_app *app, t_draw_data *d,
-		int x, int y)
+void	free_weapon_cache(t_weapon *w)
 {
-	t_weapon	*w;
-	uint32_t	*pixels;
-	uint32_t	color;
-	int			screen_xy[2];
-	int			tex_xy[2];
+	int	i;
 
-	w = &app->weapon;
-	pixels = (uint32_t *)w->texture->pixels;
-	screen_xy[0] = d->offset_x + x;
-	screen_xy[1] = d->offset_y + y;
-	tex_xy[0] = (x * d->width) / d->sprite_width + d->st_x;
-	tex_xy[1] = (y * d->hgt) / d->sprite_height + d->st_y;
-	color = pixels[tex_xy[1] * d->tex_width + tex_xy[0]];
-	if ((color & 0xFF000000) != 0)
-		mlx_put_pixel(app->image,
-			screen_xy[0], screen_xy[1],
-			convert_pixel(color));
+	i = 0;
+	while (i < COLS * ROWS)
+	{
+		free(w->frames[i].spans);
+		free(w->frames[i].px);
+		w->frames[i].spans = NULL;
+		w->frames[i].px = NULL;
+		i++;
+	}
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Loops over all pixels in the weapon sprite and draws them on the screen. */
+/*   Copies the spans of a pre-scaled frame into a layer, or clears them.     */
 /*                                                                            */
-/*   - Loops through each pixel's coordinates in both X and Y directions.     */
-/*   - Calls `draw_pixel()` to draw each valid pixel in the screen area.      */
-/*   - Ensures the weapon is drawn within the screen boundaries (both X and   */
-/*     Y offsets are respected).                                              */
+/*   - Each span is a run of opaque pixels already clipped to the screen and  */
+/*     stored in image byte order, so drawing is one block copy per span.     */
+/*   - Clearing makes the same pixels fully transparent again.                */
 /*                                                                            */
 /* ************************************************************************** */
-static void	render_weapon_loop(t_app *app, t_draw_data *d)
+static void	blit_spans(uint32_t *px, const t_sprite_frame *f, bool clear)
 {
-	int	x;
-	int	y;
+	int	i;
 
-	y = 0;
-	while (y < d->sprite_height)
+	i = 0;
+	while (i < f->n_spans)
 	{
-		if (d->offset_y + y >= 0 && d->offset_y + y < HEIGHT)
-		{
-			x = 0;
-			while (x < d->sprite_width)
-			{
-				if (d->offset_x + x >= 0 && d->offset_x + x < WIDTH)
-					draw_weapon_pixel(app, d, x, y);
-				x++;
-			}
-		}
-		y++;
+		if (clear)
+			ft_bzero(px + f->spans[i].dst,
+				f->spans[i].len * sizeof(uint32_t));
+		else
+			ft_memcpy(px + f->spans[i].dst, f->px + f->spans[i].src,
+				f->spans[i].len * sizeof(uint32_t));
+		i++;
 	}
 }
 
 /* ************************************************************************** */
 /*                                                                            */
-/*   Renders the weapon preparing drawing data and invoking the render loop.  */
+/*   Redraws the weapon layer with the current animation frame.               */
 /*                                                                            */
-/*   - Initializes the drawing data for the weapon.                           */
-/*   - Calls `render_loop()` to perform the pixel-by-pixel drawing.           */
+/*   - Only called when the frame changed: the spans of the previous frame    */
+/*     are cleared, then the new frame is copied in.                          */
 /*   - Ensures the weapon texture is valid before rendering.                  */
 /*                                                                            */
 /* ************************************************************************** */
 void	render_weapon(t_app *app)
 {
-	t_weapon	*w;
-	t_draw_data	d;
+	uint32_t	*px;
+	int			frame;
 
-	w = &app->weapon;
-	if (!w->texture)
+	px = (uint32_t *)app->layers.img[LAYER_WEAPON]->pixels;
+	frame = app->weapon.current_frame;
+	if (app->layers.weapon_frame >= 0)
+		blit_spans(px, &app->weapon.frames[app->layers.weapon_frame], true);
+	app->layers.weapon_frame = -1;
+	if (!app->weapon.texture || frame < 0 || frame >= COLS * ROWS)
 		return ;
-	init_draw_data(app, &d);
-	render_weapon_loop(app, &d);
+	blit_spans(px, &app->weapon.frames[frame], false);
+	app->layers.weapon_frame = frame;
 }
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   weapon_cache_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:09:49 by victor            #+#    #+#             */
+/*   Updated: 2026/10/18 14:09:49 by victor           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3D_bonus.h"
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Initializes drawing data for one frame of the weapon spritesheet.        */
+/*                                                                            */
+/*   - Computes the rendered width and height based on the weapon's texture.  */
+/*   - Calculates the offsets for centering the weapon on the screen.         */
+/*   - Calculates texture sub-region dimensions and starting coordinates for  */
+/*     the animation frame.                                                   */
+/*                                                                            */
+/* ************************************************************************** */
+static void	init_draw_data(t_app *app, t_draw_data *d, int frame)
+{
+	t_weapon	*w;
+	int			rendered_h;
+	int			rendered_w;
+
+	w = &app->weapon;
+	rendered_h = app->cfg.height * app->cfg.weapon_scale;
+	rendered_w = (w->texture->width * rendered_h)
+		/ w->texture->height;
+	d->sprite_height = rendered_h;
+	d->sprite_width = rendered_w;
+	d->offset_x = app->cfg.width / 2 - rendered_w / 2;
+	d->offset_y = app->cfg.height - rendered_h + Y_OFFSET;
+	d->tex_width = w->texture->width;
+	d->tex_height = w->texture->height;
+	d->width = w->texture->width / COLS;
+	d->hgt = w->texture->height / ROWS;
+	d->st_x = (frame % COLS) * d->width;
+	d->st_y = (frame / COLS) * d->hgt;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Appends one opaque pixel to a frame, opening a new span unless it        */
+/*   extends the previous one.                                                */
+/*                                                                            */
+/*   - While `f->spans` is NULL only the counters advance, so the same scan   */
+/*     sizes the buffers first and fills them on the second pass.             */
+/*                                                                            */
+/* ************************************************************************** */
+static void	push_texel(t_sprite_frame *f, int dst, uint32_t color, bool extend)
+{
+	if (!extend)
+	{
+		if (f->spans)
+			f->spans[f->n_spans] = (t_span){dst, f->n_px, 0};
+		f->n_spans++;
+	}
+	if (f->spans)
+	{
+		f->spans[f->n_spans - 1].len++;
+		f->px[f->n_px] = color;
+	}
+	f->n_px++;
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Scans one sprite row, clipped to the screen, for opaque texels.          */
+/*                                                                            */
+/*   - Samples the texture with the same nearest-neighbour mapping the        */
+/*     per-pixel renderer used.                                               */
+/*   - Texels are kept in raw byte order: converting them and writing them    */
+/*     with `mlx_put_pixel` stored exactly the same bytes.                    */
+/*                                                                            */
+/* ************************************************************************** */
+static void	scan_row(t_app *app, t_draw_data *d, int y, t_sprite_frame *f)
+{
+	uint32_t	*tex;
+	uint32_t	color;
+	bool		run;
+	int			x;
+
+	tex = (uint32_t *)app->weapon.texture->pixels
+		+ ((y * d->hgt) / d->sprite_height + d->st_y) * d->tex_width;
+	run = false;
+	x = 0;
+	if (d->offset_x < 0)
+		x = -d->offset_x;
+	while (x < d->sprite_width && d->offset_x + x < app->cfg.width)
+	{
+		color = tex[(x * d->width) / d->sprite_width + d->st_x];
+		if ((color & 0xFF000000) != 0)
+			push_texel(f, (d->offset_y + y) * app->cfg.width
+				+ d->offset_x + x, color, run);
+		run = ((color & 0xFF000000) != 0);
+		x++;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Scans every sprite row that lands on the screen.                         */
+/*                                                                            */
+/* ************************************************************************** */
+static void	scan_frame(t_app *app, t_draw_data *d, t_sprite_frame *f)
+{
+	int	y;
+
+	f->n_spans = 0;
+	f->n_px = 0;
+	y = 0;
+	if (d->offset_y < 0)
+		y = -d->offset_y;
+	while (y < d->sprite_height && d->offset_y + y < app->cfg.height)
+	{
+		scan_row(app, d, y, f);
+		y++;
+	}
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*   Pre-scales one spritesheet frame to the window into opaque spans.        */
+/*                                                                            */
+/*   - First pass counts spans and pixels, second pass fills the buffers.     */
+/*   - Returns -1 if an allocation fails, 0 on success.                       */
+/*                                                                            */
+/* ************************************************************************** */
+int	build_weapon_frame(t_app *app, int frame, t_sprite_frame *f)
+{
+	t_draw_data	d;
+
+	init_draw_data(app, &d, frame);
+	f->spans = NULL;
+	f->px = NULL;
+	scan_frame(app, &d, f);
+	f->spans = ft_calloc(f->n_spans + 1, sizeof(t_span));
+	f->px = ft_calloc(f->n_px + 1, sizeof(uint32_t));
+	if (!f->spans || !f->px)
+		return (-1);
+	scan_frame(app, &d, f);
+	return (0);
+}
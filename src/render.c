@@ -6,7 +6,7 @@
 /*   By: victor <marvin@42.fr>                      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:23:15 by victor            #+#    #+#             */
-/*   Updated: 2025/04/17 11:49:34 by victor           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:37:59 by victor           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -66,6 +66,7 @@ static void	select_texture(t_app *app, t_ray *ray, t_draw *draw, double wx)
 		else
 			draw->tex = app->game.tex_so;
 	}
+	draw->tx = 0;
 	if (!draw->tex)
 		return ;
 	draw->tx = (int)(wx * draw->tex->width);
@@ -101,7 +102,8 @@ static void	compute_texture_params(t_app *app, t_ray *ray, t_draw *draw)
 /*     be drawn using `compute_draw_boundaries()`.                            */
 /*   - It then calculates the texture parameters and applies them to the     */
 /*     drawing process using `compute_texture_params()`.                     */
-/*   - Finally, it draws the pixels for the column by calling `draw_pixels()`.*/
+/*   - Finally, it draws the pixels for the column by calling `draw_pixels()`,*/
+/*     unless no texture was loaded for the side that was hit.                */
 /*                                                                            */
 /* ************************************************************************** */
 static void	render_column(t_app *app, int x, t_ray *ray)
@@ -110,7 +112,8 @@ static void	render_column(t_app *app, int x, t_ray *ray)
 
 	compute_draw_boundaries(&draw, ray);
 	compute_texture_params(app, ray, &draw);
-	draw_pixels(app, x, &draw);
+	if (draw.tex)
+		draw_pixels(app, x, &draw);
 }
 
 /* ************************************************************************** */